@@ -0,0 +1,263 @@
+// Assembler throughput benchmark on generated sources.
+// Times Parser::parse_and_assemble() and counts the heap allocations made
+// during it, for each kind of source and size.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "parser.hxx"
+
+using std::clog;
+using std::size_t;
+using std::string;
+using std::string_view;
+using std::vector;
+
+// Heap usage of the whole program, counted by the replaced operator new
+static std::atomic<size_t> alloc_bytes{0};
+static std::atomic<size_t> alloc_cnt{0};
+
+void *operator new(size_t size)
+{
+	alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+	alloc_cnt.fetch_add(1, std::memory_order_relaxed);
+	if (auto ptr = std::malloc(size ? size : 1))
+		return ptr;
+	throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+/// Labels which can be jumped to, as addresses above 0xFFF cannot be
+constexpr size_t MAX_JUMP_LABEL = 1000;
+
+enum class Kind {
+	INS,
+	DEFINES,
+	LABELS,
+	DATA,
+};
+constexpr string_view KIND_NAMES[] = {"instructions", "defines", "labels", "db"};
+
+/// @brief Generate a source of line_cnt lines, which assembles without errors
+static string generate(Kind kind, size_t line_cnt, unsigned seed)
+{
+	std::mt19937 rng(seed);
+	auto rand = [&rng](unsigned n) { return unsigned(rng() % n); };
+
+	string ret;
+	char line[64];
+	for (size_t i = 0; i < line_cnt; ++i) {
+		auto x = rand(16);
+		auto y = rand(16);
+		switch (kind) {
+		case Kind::INS:
+			switch (rand(8)) {
+			case 0:
+				std::snprintf(line, sizeof(line), "\tld v%X, %u\n", x, rand(256));
+				break;
+			case 1:
+				std::snprintf(line, sizeof(line), "\tadd v%X, v%X\n", x, y);
+				break;
+			case 2:
+				std::snprintf(line, sizeof(line), "\tse v%X, 0x%X\n", x, y);
+				break;
+			case 3:
+				std::snprintf(line, sizeof(line), "\tdrw v%X, v%X, 5\n", x, y);
+				break;
+			case 4:
+				std::snprintf(line, sizeof(line), "\tld I, 0x3%X%X\n", x, y);
+				break;
+			case 5:
+				std::snprintf(line, sizeof(line), "\tjp 0x2%X%X ; loop\n", x, y);
+				break;
+			case 6:
+				std::snprintf(line, sizeof(line), "\tcall 0x4%X%X\n", x, y);
+				break;
+			default:
+				std::snprintf(line, sizeof(line), "\tld v%X, [I]\n", x);
+				break;
+			}
+			break;
+		case Kind::DEFINES:
+			// Defines and uses of recent ones
+			if (i % 2 == 0)
+				std::snprintf(
+					line, sizeof(line), "define CONST_%zu %u\n", i, rand(255)
+				);
+			else
+				std::snprintf(
+					line, sizeof(line), "\tld v%X, CONST_%zu + 1\n", x,
+					i - 1 - 2 * rand(std::min<size_t>(i / 2 + 1, 8))
+				);
+			break;
+		case Kind::LABELS:
+			if (i % 2 == 0)
+				std::snprintf(line, sizeof(line), "label_%zu:\n", i / 2);
+			else
+				std::snprintf(
+					line, sizeof(line), "\tjp label_%u\n",
+					rand(std::min<size_t>(i / 2 + 1, MAX_JUMP_LABEL))
+				);
+			break;
+		case Kind::DATA:
+			std::snprintf(line, sizeof(line), "\tdb 0x%02X\n", rand(256));
+			break;
+		}
+		ret += line;
+	}
+	return ret;
+}
+
+static vector<string_view> split_lines(string_view text)
+{
+	vector<string_view> ret;
+	while (!text.empty()) {
+		auto nl = text.find('\n');
+		ret.push_back(text.substr(0, nl));
+		text.remove_prefix(nl == string_view::npos ? text.size() : nl + 1);
+	}
+	return ret;
+}
+
+struct Result {
+	double seconds = 0;
+	size_t bytes = 0;
+	size_t allocs = 0;
+};
+
+/// @brief Best of the runs, repeated till min_seconds are spent in total
+static bool run(
+	const vector<string_view> &lines, unsigned jobs, double min_seconds,
+	Result &best
+)
+{
+	constexpr int MIN_RUNS = 3;
+	double total = 0;
+
+	for (int i = 0; i < MIN_RUNS || total < min_seconds; ++i) {
+		Parser parser(lines);
+		auto bytes = alloc_bytes.load();
+		auto allocs = alloc_cnt.load();
+		auto start = std::chrono::steady_clock::now();
+		auto bincode = parser.parse_and_assemble(jobs);
+		std::chrono::duration<double> took =
+			std::chrono::steady_clock::now() - start;
+		if (!bincode)
+			return false;
+
+		total += took.count();
+		if (i == 0 || took.count() < best.seconds) {
+			best.seconds = took.count();
+			best.bytes = alloc_bytes.load() - bytes;
+			best.allocs = alloc_cnt.load() - allocs;
+		}
+	}
+	return true;
+}
+
+static void print_usage(const char *name)
+{
+	clog << "Usage: " << name << " [options]\n"
+		 << "Options:\n"
+		 << "  -j <jobs>          Threads to assemble with (default: 1)\n"
+		 << "  --kind <kind>      Only this kind of source: instructions,\n"
+		 << "                     defines, labels or db\n"
+		 << "  --max-lines <n>    Largest source, sizes go from 1K lines up\n"
+		 << "                     by 10x (default: 1000000, at most 10M)\n"
+		 << "  --min-time <s>     Seconds to spend on each size at least\n"
+		 << "                     (default: 0.5)\n"
+		 << "  --json             Print results as a JSON array\n";
+}
+
+int main(int argc, char const **argv)
+{
+	auto name = argc > 0 ? argv[0] : "c8asm_bench";
+	unsigned jobs = 1;
+	size_t max_lines = 1'000'000;
+	double min_seconds = 0.5;
+	bool is_json = false;
+	vector<Kind> kinds = {
+		Kind::INS, Kind::DEFINES, Kind::LABELS, Kind::DATA};
+
+	for (int i = 1; i < argc; ++i) {
+		string_view arg = argv[i];
+		if (arg == "-j" && i + 1 < argc) {
+			jobs = std::max(1UL, std::strtoul(argv[++i], nullptr, 10));
+		} else if (arg == "--max-lines" && i + 1 < argc) {
+			max_lines = std::strtoull(argv[++i], nullptr, 10);
+		} else if (arg == "--min-time" && i + 1 < argc) {
+			min_seconds = std::strtod(argv[++i], nullptr);
+		} else if (arg == "--json") {
+			is_json = true;
+		} else if (arg == "--kind" && i + 1 < argc) {
+			auto kind =
+				std::find(std::begin(KIND_NAMES), std::end(KIND_NAMES), argv[++i]);
+			if (kind == std::end(KIND_NAMES)) {
+				print_usage(name);
+				return 1;
+			}
+			kinds = {Kind(kind - std::begin(KIND_NAMES))};
+		} else {
+			print_usage(name);
+			return 1;
+		}
+	}
+	max_lines = std::min<size_t>(max_lines, 10'000'000);
+
+	if (is_json)
+		std::printf("[");
+	else
+		std::printf(
+			"%-12s %9s %4s %10s %12s %12s %10s\n", "kind", "lines", "jobs",
+			"ms", "lines/s", "alloc_bytes", "allocs"
+		);
+	bool is_first = true;
+	for (auto kind : kinds) {
+		for (size_t line_cnt = 1000; line_cnt <= max_lines; line_cnt *= 10) {
+			auto text = generate(kind, line_cnt, 1);
+			auto lines = split_lines(text);
+
+			Result result;
+			if (!run(lines, jobs, min_seconds, result)) {
+				clog << "Generated " << KIND_NAMES[int(kind)]
+					 << " source has errors\n";
+				return 1;
+			}
+			if (is_json) {
+				std::printf(
+					"%s\n  {\"name\": \"asm/%s/%zu\", \"unit\": \"line\", "
+					"\"ns_per_op\": %.3f, \"ops_per_sec\": %.0f, "
+					"\"alloc_bytes\": %zu, \"allocs\": %zu}",
+					is_first ? "" : ",", KIND_NAMES[int(kind)].data(), line_cnt,
+					result.seconds * 1e9 / line_cnt, line_cnt / result.seconds,
+					result.bytes, result.allocs
+				);
+			} else {
+				std::printf(
+					"%-12s %9zu %4u %10.3f %12.0f %12zu %10zu\n",
+					KIND_NAMES[int(kind)].data(), line_cnt, jobs,
+					result.seconds * 1e3, line_cnt / result.seconds, result.bytes,
+					result.allocs
+				);
+			}
+			is_first = false;
+			std::fflush(stdout);
+		}
+	}
+	if (is_json)
+		std::printf("\n]\n");
+
+	return 0;
+}
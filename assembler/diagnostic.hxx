@@ -0,0 +1,19 @@
+#ifndef ASSEMBLER_DIAGNOSTIC_HXX_INCLUDED
+#define ASSEMBLER_DIAGNOSTIC_HXX_INCLUDED
+
+#include <string>
+
+/// @brief Region of a line, line and column are 0-based
+struct Span {
+	unsigned line = 0;
+	unsigned column = 0;
+	unsigned length = 0;
+};
+
+/// @brief An error found in the source, reported once assembly is done
+struct Diagnostic {
+	std::string msg;
+	Span span;
+};
+
+#endif // END diagnostic.hxx
@@ -0,0 +1,389 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "json.hxx"
+
+using std::nullopt;
+using std::optional;
+using std::string;
+using std::string_view;
+
+/// Arrays and objects nested deeper than this are rejected
+constexpr int MAX_DEPTH = 128;
+
+// Recursive descent over the text, fails on the first error
+class JsonReader
+{
+public:
+	explicit JsonReader(string_view text_)
+		: text(text_)
+	{
+	}
+
+	optional<Json> read_document()
+	{
+		auto ret = read_value(0);
+		skip_space();
+		if (!ret || pos != text.size())
+			return nullopt;
+		return ret;
+	}
+
+private:
+	void skip_space()
+	{
+		while (pos < text.size()
+			   && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n'
+				   || text[pos] == '\r'))
+			pos++;
+	}
+
+	bool consume(string_view s)
+	{
+		if (text.substr(pos, s.size()) != s)
+			return false;
+		pos += s.size();
+		return true;
+	}
+
+	optional<Json> read_value(int depth)
+	{
+		skip_space();
+		if (pos == text.size() || depth > MAX_DEPTH)
+			return nullopt;
+
+		switch (text[pos]) {
+		case '{':
+			return read_object(depth);
+		case '[':
+			return read_array(depth);
+		case '"':
+			if (auto s = read_string())
+				return Json(std::move(*s));
+			return nullopt;
+		case 't':
+			return consume("true") ? optional<Json>(true) : nullopt;
+		case 'f':
+			return consume("false") ? optional<Json>(false) : nullopt;
+		case 'n':
+			return consume("null") ? optional<Json>(Json()) : nullopt;
+		default:
+			return read_number();
+		}
+	}
+
+	optional<Json> read_number()
+	{
+		auto beg = pos;
+		if (pos < text.size() && text[pos] == '-')
+			pos++;
+		auto is_num_char = [](char c) {
+			return ('0' <= c && c <= '9') || c == '.' || c == 'e' || c == 'E'
+				   || c == '+' || c == '-';
+		};
+		while (pos < text.size() && is_num_char(text[pos]))
+			pos++;
+
+		string num(text.substr(beg, pos - beg));
+		char *end = nullptr;
+		double val = std::strtod(num.c_str(), &end);
+		if (num.empty() || end != num.c_str() + num.size())
+			return nullopt;
+		return Json(val);
+	}
+
+	optional<unsigned> read_hex4()
+	{
+		if (pos + 4 > text.size())
+			return nullopt;
+		unsigned val = 0;
+		for (int i = 0; i < 4; ++i) {
+			char c = text[pos++];
+			val <<= 4;
+			if ('0' <= c && c <= '9')
+				val |= c - '0';
+			else if ('a' <= c && c <= 'f')
+				val |= c - 'a' + 10;
+			else if ('A' <= c && c <= 'F')
+				val |= c - 'A' + 10;
+			else
+				return nullopt;
+		}
+		return val;
+	}
+
+	static void append_utf8(string &out, unsigned cp)
+	{
+		if (cp < 0x80) {
+			out += char(cp);
+		} else if (cp < 0x800) {
+			out += char(0xC0 | (cp >> 6));
+			out += char(0x80 | (cp & 0x3F));
+		} else if (cp < 0x10000) {
+			out += char(0xE0 | (cp >> 12));
+			out += char(0x80 | ((cp >> 6) & 0x3F));
+			out += char(0x80 | (cp & 0x3F));
+		} else {
+			out += char(0xF0 | (cp >> 18));
+			out += char(0x80 | ((cp >> 12) & 0x3F));
+			out += char(0x80 | ((cp >> 6) & 0x3F));
+			out += char(0x80 | (cp & 0x3F));
+		}
+	}
+
+	optional<string> read_string()
+	{
+		pos++; // Opening quote
+		string ret;
+		while (pos < text.size()) {
+			char c = text[pos++];
+			if (c == '"')
+				return ret;
+			if (c != '\\') {
+				ret += c;
+				continue;
+			}
+
+			if (pos == text.size())
+				return nullopt;
+			switch (text[pos++]) {
+			case '"':
+				ret += '"';
+				break;
+			case '\\':
+				ret += '\\';
+				break;
+			case '/':
+				ret += '/';
+				break;
+			case 'b':
+				ret += '\b';
+				break;
+			case 'f':
+				ret += '\f';
+				break;
+			case 'n':
+				ret += '\n';
+				break;
+			case 'r':
+				ret += '\r';
+				break;
+			case 't':
+				ret += '\t';
+				break;
+			case 'u': {
+				auto cp = read_hex4();
+				if (!cp)
+					return nullopt;
+				// Characters outside the BMP are escaped as surrogate pairs
+				if (0xD800 <= *cp && *cp < 0xDC00 && consume("\\u")) {
+					auto low = read_hex4();
+					if (!low || *low < 0xDC00 || *low > 0xDFFF)
+						return nullopt;
+					*cp = 0x10000 + ((*cp - 0xD800) << 10) + (*low - 0xDC00);
+				}
+				append_utf8(ret, *cp);
+				break;
+			}
+			default:
+				return nullopt;
+			}
+		}
+		return nullopt;
+	}
+
+	optional<Json> read_array(int depth)
+	{
+		pos++;
+		Json::Array ret;
+		skip_space();
+		if (consume("]"))
+			return Json(std::move(ret));
+
+		while (true) {
+			auto value = read_value(depth + 1);
+			if (!value)
+				return nullopt;
+			ret.push_back(std::move(*value));
+			skip_space();
+			if (consume("]"))
+				return Json(std::move(ret));
+			if (!consume(","))
+				return nullopt;
+		}
+	}
+
+	optional<Json> read_object(int depth)
+	{
+		pos++;
+		Json::Object ret;
+		skip_space();
+		if (consume("}"))
+			return Json(std::move(ret));
+
+		while (true) {
+			skip_space();
+			if (pos == text.size() || text[pos] != '"')
+				return nullopt;
+			auto key = read_string();
+			skip_space();
+			if (!key || !consume(":"))
+				return nullopt;
+			auto value = read_value(depth + 1);
+			if (!value)
+				return nullopt;
+			ret[std::move(*key)] = std::move(*value);
+
+			skip_space();
+			if (consume("}"))
+				return Json(std::move(ret));
+			if (!consume(","))
+				return nullopt;
+		}
+	}
+
+	string_view text;
+	size_t pos = 0;
+};
+
+optional<Json> Json::parse(string_view text)
+{
+	return JsonReader(text).read_document();
+}
+
+string Json::dump() const
+{
+	string ret;
+	dump(ret);
+	return ret;
+}
+
+static void dump_string(string &out, string_view s)
+{
+	out += '"';
+	for (char c : s) {
+		switch (c) {
+		case '"':
+			out += "\\\"";
+			break;
+		case '\\':
+			out += "\\\\";
+			break;
+		case '\n':
+			out += "\\n";
+			break;
+		case '\r':
+			out += "\\r";
+			break;
+		case '\t':
+			out += "\\t";
+			break;
+		default:
+			if (static_cast<unsigned char>(c) < 0x20) {
+				char esc[8];
+				std::snprintf(esc, sizeof(esc), "\\u%04X", unsigned(c));
+				out += esc;
+			} else {
+				out += c;
+			}
+		}
+	}
+	out += '"';
+}
+
+void Json::dump(string &out) const
+{
+	switch (type) {
+	case Type::NUL:
+		out += "null";
+		break;
+	case Type::BOOL:
+		out += bool_val ? "true" : "false";
+		break;
+	case Type::NUMBER: {
+		char num[32];
+		// Integers are the common case(ids, positions), print them exactly
+		if (std::isfinite(num_val) && num_val == std::trunc(num_val)
+			&& std::fabs(num_val) < 1e15)
+			std::snprintf(num, sizeof(num), "%lld", static_cast<long long>(num_val));
+		else if (std::isfinite(num_val))
+			std::snprintf(num, sizeof(num), "%.17g", num_val);
+		else
+			std::snprintf(num, sizeof(num), "null");
+		out += num;
+		break;
+	}
+	case Type::STRING:
+		dump_string(out, str_val);
+		break;
+	case Type::ARRAY:
+		out += '[';
+		for (size_t i = 0; i < arr_val.size(); ++i) {
+			if (i != 0)
+				out += ',';
+			arr_val[i].dump(out);
+		}
+		out += ']';
+		break;
+	case Type::OBJECT: {
+		out += '{';
+		bool is_first = true;
+		for (auto &[key, value] : obj_val) {
+			if (!is_first)
+				out += ',';
+			is_first = false;
+			dump_string(out, key);
+			out += ':';
+			value.dump(out);
+		}
+		out += '}';
+		break;
+	}
+	}
+}
+
+const string &Json::as_string() const
+{
+	static const string EMPTY;
+	return type == Type::STRING ? str_val : EMPTY;
+}
+
+const Json::Array &Json::as_array() const
+{
+	static const Array EMPTY;
+	return type == Type::ARRAY ? arr_val : EMPTY;
+}
+
+const Json::Object &Json::as_object() const
+{
+	static const Object EMPTY;
+	return type == Type::OBJECT ? obj_val : EMPTY;
+}
+
+const Json &Json::operator[](string_view key) const
+{
+	static const Json NUL;
+	if (type != Type::OBJECT)
+		return NUL;
+	auto found = obj_val.find(key);
+	return found == obj_val.end() ? NUL : found->second;
+}
+
+Json &Json::operator[](string_view key)
+{
+	if (type != Type::OBJECT)
+		*this = Object{};
+	auto found = obj_val.find(key);
+	if (found == obj_val.end())
+		found = obj_val.emplace(string(key), Json()).first;
+	return found->second;
+}
+
+void Json::push_back(Json value)
+{
+	if (type != Type::ARRAY)
+		*this = Array{};
+	arr_val.push_back(std::move(value));
+}
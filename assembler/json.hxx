@@ -0,0 +1,99 @@
+#ifndef ASSEMBLER_JSON_HXX_INCLUDED
+#define ASSEMBLER_JSON_HXX_INCLUDED
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/// @brief JSON value, just enough of it for the language server protocol.
+/// Lookups of missing keys or of the wrong type give a null value(or an
+/// empty or zero one) instead of failing, so that optional fields of a
+/// message need no checks at every step.
+class Json
+{
+public:
+	enum class Type : std::uint8_t {
+		NUL,
+		BOOL,
+		NUMBER,
+		STRING,
+		ARRAY,
+		OBJECT,
+	};
+	using Array = std::vector<Json>;
+	using Object = std::map<std::string, Json, std::less<>>;
+
+	Json() = default;
+	Json(std::nullptr_t) {}
+	Json(bool b)
+		: type(Type::BOOL)
+		, bool_val(b)
+	{
+	}
+	template <
+		typename T,
+		typename = std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>
+	Json(T n)
+		: type(Type::NUMBER)
+		, num_val(static_cast<double>(n))
+	{
+	}
+	Json(std::string s)
+		: type(Type::STRING)
+		, str_val(std::move(s))
+	{
+	}
+	Json(std::string_view s)
+		: Json(std::string(s))
+	{
+	}
+	Json(const char *s)
+		: Json(std::string(s))
+	{
+	}
+	Json(Array a)
+		: type(Type::ARRAY)
+		, arr_val(std::move(a))
+	{
+	}
+	Json(Object o)
+		: type(Type::OBJECT)
+		, obj_val(std::move(o))
+	{
+	}
+
+	/// @return nullopt if the text is not a single valid JSON value
+	static std::optional<Json> parse(std::string_view text);
+	std::string dump() const;
+
+	Type get_type() const { return type; }
+	bool is_null() const { return type == Type::NUL; }
+	bool as_bool() const { return type == Type::BOOL && bool_val; }
+	double as_number() const { return type == Type::NUMBER ? num_val : 0; }
+	const std::string &as_string() const;
+	const Array &as_array() const;
+	const Object &as_object() const;
+
+	/// Member of an object, null if not an object or there is no such member
+	const Json &operator[](std::string_view key) const;
+	/// Member of an object, added if missing, a null value becomes an object
+	Json &operator[](std::string_view key);
+	/// Append to an array, a null value becomes an array
+	void push_back(Json value);
+
+private:
+	void dump(std::string &out) const;
+
+	Type type = Type::NUL;
+	bool bool_val = false;
+	double num_val = 0;
+	std::string str_val;
+	Array arr_val;
+	Object obj_val;
+};
+
+#endif // END json.hxx
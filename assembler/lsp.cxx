@@ -0,0 +1,815 @@
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include "chip8.hxx"
+#include "lsp.hxx"
+#include "parser.hxx"
+#include "preprocessor.hxx"
+
+using std::nullopt;
+using std::optional;
+using std::shared_ptr;
+using std::size_t;
+using std::string;
+using std::string_view;
+using std::vector;
+
+// JSON-RPC error codes
+constexpr int PARSE_ERROR = -32700;
+constexpr int METHOD_NOT_FOUND = -32601;
+
+// LSP constants
+constexpr int SYNC_INCREMENTAL = 2;
+constexpr int SEVERITY_ERROR = 1;
+constexpr int COMPLETION_FUNCTION = 3;
+constexpr int COMPLETION_VARIABLE = 6;
+constexpr int COMPLETION_KEYWORD = 14;
+constexpr int COMPLETION_REFERENCE = 18;
+constexpr int COMPLETION_CONSTANT = 21;
+
+/// Bytes of code shown by hover, longer data is cut short
+constexpr size_t HOVER_MAX_BYTES = 16;
+
+/// @brief Name offered by completion and its kind
+using Name = std::pair<string_view, int>;
+
+struct LanguageServer::Document {
+	string uri;
+	string path;
+	// Text of each line. An edited line gets a new string instead of being
+	// modified, as the lines of the last assembly still refer to the old one.
+	vector<shared_ptr<const string>> texts;
+	// Views of texts and the token cache, the scan of each line. Edits patch
+	// it in place, it is the main file of every assembly.
+	shared_ptr<ScannedFile> file = std::make_shared<ScannedFile>();
+	// Texts replaced by edits, kept till the parser is made anew as its
+	// chunks may still refer to them
+	vector<shared_ptr<const string>> retired;
+	// Labels, macros and defines of the token cache
+	std::multimap<string_view, int, IgnoreCaseLess> names;
+	bool is_assembled = false;
+
+	// Lines [first, last) are edited since the last assembly, they replace
+	// its lines [first, last - delta)
+	size_t edit_first = 0;
+	size_t edit_last = 0;
+	std::ptrdiff_t edit_delta = 0;
+	// Whether the edits can be patched into the last preprocessed source
+	bool can_patch = true;
+
+	Preprocessor preprocessor{false};
+	std::unique_ptr<Parser> parser;
+	shared_ptr<const Preprocessed> source;
+	// Macros and defines of each included file, sorted, scanned once a file
+	std::map<shared_ptr<const ScannedFile>, vector<Name>> included_names;
+	// Files which have diagnostics published, they are cleared once fixed
+	std::set<string> diagnosed;
+
+	void add_names(const ScannedLine &line);
+	void remove_names(const ScannedLine &line);
+	bool is_macro(string_view name) const;
+	/// Whether the line of the last assembly is copied as it is
+	bool is_copied(size_t line, string_view text) const;
+	/// Track lines [first, last) being replaced by lines, before it is done
+	void note_edit(size_t first, size_t last, const vector<ScannedLine> &lines);
+};
+
+static inline bool is_ident_char(char c)
+{
+	return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+static string uri_to_path(string_view uri)
+{
+	constexpr string_view SCHEME = "file://";
+	if (uri.substr(0, SCHEME.size()) != SCHEME)
+		return string(uri);
+	uri.remove_prefix(SCHEME.size());
+
+	string ret;
+	for (size_t i = 0; i < uri.size(); ++i) {
+		if (uri[i] == '%' && i + 2 < uri.size()) {
+			ret += char(std::strtol(string(uri.substr(i + 1, 2)).c_str(), nullptr, 16));
+			i += 2;
+		} else {
+			ret += uri[i];
+		}
+	}
+	return ret;
+}
+
+static string path_to_uri(string_view path)
+{
+	constexpr char HEX[] = "0123456789ABCDEF";
+	string ret = "file://";
+	for (char c : path) {
+		if (is_ident_char(c) || c == '/' || c == '-' || c == '.' || c == '~') {
+			ret += c;
+		} else {
+			ret += '%';
+			ret += HEX[(c >> 4) & 0xF];
+			ret += HEX[c & 0xF];
+		}
+	}
+	return ret;
+}
+
+static size_t utf8_length(char lead)
+{
+	auto c = static_cast<unsigned char>(lead);
+	return c < 0xC0 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+}
+
+/// @brief Position sent by the client clamped to [0, limit], a negative, NaN
+/// or too large double cannot be converted to size_t
+static size_t to_index(const Json &num, size_t limit)
+{
+	auto val = num.as_number();
+	if (!(val > 0))
+		return 0;
+	return val < double(limit) ? size_t(val) : limit;
+}
+
+// LSP columns count UTF-16 code units, the assembler counts bytes
+static size_t byte_column(string_view line, size_t units)
+{
+	size_t i = 0;
+	for (size_t u = 0; i < line.size() && u < units; ++u) {
+		auto len = utf8_length(line[i]);
+		u += len == 4; // Surrogate pair
+		i += len;
+	}
+	return std::min(i, line.size());
+}
+
+static size_t utf16_column(string_view line, size_t bytes)
+{
+	size_t units = 0;
+	for (size_t i = 0; i < line.size() && i < bytes;) {
+		auto len = utf8_length(line[i]);
+		units += len == 4 ? 2 : 1;
+		i += len;
+	}
+	return units;
+}
+
+static Json make_range(string_view line, unsigned line_num, size_t beg, size_t end)
+{
+	Json range;
+	range["start"]["line"] = line_num;
+	range["start"]["character"] = utf16_column(line, beg);
+	range["end"]["line"] = line_num;
+	range["end"]["character"] = utf16_column(line, end);
+	return range;
+}
+
+static vector<shared_ptr<const string>> split_lines(string_view text)
+{
+	vector<shared_ptr<const string>> ret;
+	while (true) {
+		auto nl = text.find('\n');
+		auto line = text.substr(0, nl);
+		if (!line.empty() && line.back() == '\r')
+			line.remove_suffix(1);
+		ret.push_back(std::make_shared<const string>(line));
+		if (nl == string_view::npos)
+			return ret;
+		text.remove_prefix(nl + 1);
+	}
+}
+
+/// @brief Names which a line defines, for completion
+template <typename Add>
+static void names_of(const ScannedLine &line, Add add)
+{
+	if (!line.label.empty())
+		add(line.label, COMPLETION_REFERENCE);
+	if (line.kind == LineKind::MACRO) {
+		add(line.word, COMPLETION_FUNCTION);
+	} else if (line.kind == LineKind::WORD && iequals(line.word, "DEFINE")) {
+		auto rest = line.rest;
+		add(rest.substr(0, rest.find_first_of(" \t")), COMPLETION_CONSTANT);
+	}
+}
+
+/// @brief Replace items [first, last) of vec by those of with, in place
+/// where they overlap so that a line edited in place moves nothing.
+template <typename T>
+static void splice(vector<T> &vec, size_t first, size_t last, vector<T> with)
+{
+	auto common = std::min(last - first, with.size());
+	std::move(with.begin(), with.begin() + common, vec.begin() + first);
+	if (common < last - first)
+		vec.erase(vec.begin() + first + common, vec.begin() + last);
+	else
+		vec.insert(
+			vec.begin() + last, std::make_move_iterator(with.begin() + common),
+			std::make_move_iterator(with.end())
+		);
+}
+
+void LanguageServer::Document::add_names(const ScannedLine &line)
+{
+	names_of(line, [this](string_view name, int kind) {
+		if (!name.empty())
+			names.emplace(name, kind);
+	});
+}
+
+void LanguageServer::Document::remove_names(const ScannedLine &line)
+{
+	// The very name of the line, others may have the same text
+	names_of(line, [this](string_view name, int) {
+		auto [beg, end] = names.equal_range(name);
+		for (auto it = beg; it != end; ++it) {
+			if (it->first.data() == name.data()) {
+				names.erase(it);
+				break;
+			}
+		}
+	});
+}
+
+bool LanguageServer::Document::is_macro(string_view name) const
+{
+	auto [beg, end] = names.equal_range(name);
+	if (std::any_of(beg, end, [](auto &kv) { return kv.second == COMPLETION_FUNCTION; }))
+		return true;
+	auto less = [](const Name &a, const Name &b) {
+		return IgnoreCaseLess()(a.first, b.first);
+	};
+	for (auto &kv : included_names) {
+		auto range = std::equal_range(
+			kv.second.begin(), kv.second.end(), Name{name, 0}, less
+		);
+		if (std::any_of(range.first, range.second, [](auto &n) {
+				return n.second == COMPLETION_FUNCTION;
+			}))
+			return true;
+	}
+	return false;
+}
+
+bool LanguageServer::Document::is_copied(size_t line, string_view text) const
+{
+	auto at = source->lines_of_main(static_cast<unsigned>(line));
+	return !at.empty() && source->lines[at.front()].data() == text.data();
+}
+
+void LanguageServer::Document::note_edit(
+	size_t first, size_t last, const vector<ScannedLine> &lines
+)
+{
+	std::ptrdiff_t delta = lines.size() - (last - first);
+	if (!source || !can_patch)
+		return;
+
+	// New lines can be patched in if they are not preprocessed
+	for (auto &line : lines) {
+		if (line.kind != LineKind::PLAIN
+			&& !(line.kind == LineKind::WORD && !is_macro(line.word)))
+			can_patch = false;
+	}
+	// Lines between edits would have to be checked too, so only an edit
+	// touching the earlier ones is patched
+	bool is_first = is_assembled;
+	if (!is_first && (first > edit_last || last < edit_first))
+		can_patch = false;
+	if (!can_patch)
+		return;
+
+	// Replaced lines which are not edited yet must be copied as they are
+	for (auto i = first; i < last; ++i) {
+		if (!is_first && i >= edit_first && i < edit_last)
+			continue;
+		auto old_line = !is_first && i >= edit_last ? i - edit_delta : i;
+		if (!is_copied(old_line, file->text[i])) {
+			can_patch = false;
+			return;
+		}
+	}
+
+	if (is_first) {
+		edit_first = first;
+		edit_last = first + lines.size();
+		edit_delta = delta;
+		return;
+	}
+	edit_last = edit_last > last ? edit_last + delta : first + lines.size();
+	edit_first = std::min(edit_first, first);
+	edit_delta += delta;
+}
+
+/// @brief Identifier at the column, empty if there is none
+static string_view word_at(string_view line, size_t column)
+{
+	auto beg = std::min(column, line.size());
+	auto end = beg;
+	while (beg > 0 && is_ident_char(line[beg - 1]))
+		beg--;
+	while (end < line.size() && is_ident_char(line[end]))
+		end++;
+	return line.substr(beg, end - beg);
+}
+
+LanguageServer::LanguageServer() : LanguageServer(STDIN_FILENO, stdout) {}
+LanguageServer::LanguageServer(int in_fd_, std::FILE *out_) : in_fd(in_fd_), out(out_) {}
+LanguageServer::~LanguageServer() = default;
+
+int LanguageServer::run()
+{
+	while (auto text = read_message()) {
+		if (auto msg = Json::parse(*text)) {
+			handle(*msg);
+		} else {
+			Json error;
+			error["jsonrpc"] = "2.0";
+			error["id"] = nullptr;
+			error["error"]["code"] = PARSE_ERROR;
+			error["error"]["message"] = "Invalid JSON";
+			send(error);
+		}
+		if (is_exiting)
+			return is_shutdown ? 0 : 1;
+
+		// Caught up with the client, a burst of edits is assembled once
+		if (!has_input()) {
+			for (auto &kv : documents)
+				assemble(*kv.second);
+		}
+	}
+	return 1;
+}
+
+optional<string> LanguageServer::read_message()
+{
+	constexpr string_view LENGTH = "content-length:";
+	while (true) {
+		auto header_end = input.find("\r\n\r\n");
+		if (header_end != string::npos) {
+			// Headers are case-insensitive, only Content-Length matters
+			size_t length = 0;
+			for (size_t pos = 0; pos < header_end;) {
+				auto eol = input.find("\r\n", pos);
+				string_view header(input.data() + pos, eol - pos);
+				if (header.size() > LENGTH.size()
+					&& iequals(header.substr(0, LENGTH.size()), LENGTH))
+					length = std::strtoul(
+						string(header.substr(LENGTH.size())).c_str(), nullptr, 10
+					);
+				pos = eol + 2;
+			}
+
+			auto body = header_end + 4;
+			if (input.size() >= body + length) {
+				string ret = input.substr(body, length);
+				input.erase(0, body + length);
+				return ret;
+			}
+		}
+
+		char chunk[1 << 16];
+		auto n = read(in_fd, chunk, sizeof(chunk));
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return nullopt;
+		input.append(chunk, n);
+	}
+}
+
+bool LanguageServer::has_input()
+{
+	if (!input.empty())
+		return true;
+	pollfd fd{in_fd, POLLIN, 0};
+	return poll(&fd, 1, 0) > 0;
+}
+
+void LanguageServer::send(const Json &msg)
+{
+	auto body = msg.dump();
+	std::fprintf(out, "Content-Length: %zu\r\n\r\n", body.size());
+	std::fwrite(body.data(), 1, body.size(), out);
+	std::fflush(out);
+}
+
+void LanguageServer::reply(const Json &id, Json result)
+{
+	Json msg;
+	msg["jsonrpc"] = "2.0";
+	msg["id"] = id;
+	msg["result"] = std::move(result);
+	send(msg);
+}
+
+void LanguageServer::handle(const Json &msg)
+{
+	auto &method = msg["method"].as_string();
+	auto &params = msg["params"];
+	auto &id = msg["id"];
+
+	if (method == "initialize") {
+		Json result;
+		auto &caps = result["capabilities"];
+		caps["textDocumentSync"]["openClose"] = true;
+		caps["textDocumentSync"]["change"] = SYNC_INCREMENTAL;
+		caps["hoverProvider"] = true;
+		caps["definitionProvider"] = true;
+		caps["completionProvider"]["resolveProvider"] = false;
+		result["serverInfo"]["name"] = "c8asm";
+		reply(id, std::move(result));
+	} else if (method == "shutdown") {
+		is_shutdown = true;
+		reply(id, nullptr);
+	} else if (method == "exit") {
+		is_exiting = true;
+	} else if (method == "textDocument/didOpen") {
+		open(params);
+	} else if (method == "textDocument/didChange") {
+		change(params);
+	} else if (method == "textDocument/didClose") {
+		close(params);
+	} else if (method == "textDocument/hover") {
+		reply(id, hover(params));
+	} else if (method == "textDocument/definition") {
+		reply(id, definition(params));
+	} else if (method == "textDocument/completion") {
+		reply(id, completion(params));
+	} else if (!id.is_null()) {
+		// Notifications which are not handled are ignored, requests are not
+		Json error;
+		error["jsonrpc"] = "2.0";
+		error["id"] = id;
+		error["error"]["code"] = METHOD_NOT_FOUND;
+		error["error"]["message"] = "Method not found: " + method;
+		send(error);
+	}
+}
+
+LanguageServer::Document *LanguageServer::find_document(const Json &params)
+{
+	auto found = documents.find(params["textDocument"]["uri"].as_string());
+	return found == documents.end() ? nullptr : found->second.get();
+}
+
+void LanguageServer::open(const Json &params)
+{
+	auto &item = params["textDocument"];
+	auto doc = std::make_unique<Document>();
+	doc->uri = item["uri"].as_string();
+	doc->path = uri_to_path(doc->uri);
+	doc->texts = split_lines(item["text"].as_string());
+	auto &file = *doc->file;
+	for (auto &text : doc->texts) {
+		file.text.push_back(*text);
+		file.lines.push_back(scan_line(*text));
+		doc->add_names(file.lines.back());
+	}
+	documents[doc->uri] = std::move(doc);
+}
+
+void LanguageServer::change(const Json &params)
+{
+	auto doc = find_document(params);
+	if (!doc)
+		return;
+
+	for (auto &change : params["contentChanges"].as_array()) {
+		auto &text = change["text"].as_string();
+		auto &range = change["range"];
+		size_t first = 0;
+		size_t last = doc->texts.size();
+		string joined = text;
+
+		// Without a range the change is the whole text
+		if (!range.is_null()) {
+			auto line_of = [doc](const Json &pos) {
+				return to_index(pos["line"], doc->texts.size() - 1);
+			};
+			first = line_of(range["start"]);
+			last = std::max(first, line_of(range["end"])) + 1;
+			auto &first_text = *doc->texts[first];
+			auto &last_text = *doc->texts[last - 1];
+			auto beg = byte_column(
+				first_text, to_index(range["start"]["character"], first_text.size())
+			);
+			auto end = byte_column(
+				last_text, to_index(range["end"]["character"], last_text.size())
+			);
+			joined = first_text.substr(0, beg) + text + last_text.substr(end);
+		}
+
+		// Only the lines touched by the change are scanned again
+		auto texts = split_lines(joined);
+		vector<string_view> views;
+		vector<ScannedLine> lines;
+		views.reserve(texts.size());
+		lines.reserve(texts.size());
+		for (auto &line : texts) {
+			views.push_back(*line);
+			lines.push_back(scan_line(*line));
+		}
+
+		doc->note_edit(first, last, lines);
+		doc->is_assembled = false;
+		auto &file = *doc->file;
+		for (auto i = first; i < last; ++i) {
+			doc->remove_names(file.lines[i]);
+			doc->retired.push_back(std::move(doc->texts[i]));
+		}
+		for (auto &line : lines)
+			doc->add_names(line);
+		splice(doc->texts, first, last, std::move(texts));
+		splice(file.text, first, last, std::move(views));
+		splice(file.lines, first, last, std::move(lines));
+	}
+}
+
+void LanguageServer::close(const Json &params)
+{
+	auto doc = find_document(params);
+	if (!doc)
+		return;
+
+	for (auto &uri : doc->diagnosed) {
+		Json msg;
+		msg["jsonrpc"] = "2.0";
+		msg["method"] = "textDocument/publishDiagnostics";
+		msg["params"]["uri"] = uri;
+		msg["params"]["diagnostics"] = Json::Array{};
+		send(msg);
+	}
+	documents.erase(doc->uri);
+}
+
+void LanguageServer::assemble(Document &doc)
+{
+	if (doc.is_assembled)
+		return;
+
+	// Edits of plain lines are patched into the last source, else everything
+	// is preprocessed again and the included files are looked at again
+	if (doc.source && doc.can_patch) {
+		doc.source = Preprocessor::patch(
+			*doc.source, doc.edit_first, doc.edit_last - doc.edit_delta,
+			doc.edit_last
+		);
+	} else {
+		doc.source = doc.preprocessor.run(doc.path, doc.file);
+		std::map<shared_ptr<const ScannedFile>, vector<Name>> included;
+		for (size_t i = 1; i < doc.source->files.size(); ++i) {
+			auto &file = doc.source->files[i];
+			auto found = doc.included_names.find(file);
+			if (found != doc.included_names.end()) {
+				included.insert(std::move(*found));
+				continue;
+			}
+			// Files without directives are not scanned when loaded
+			auto &names = included[file];
+			auto add = [&names](string_view name, int kind) {
+				if (!name.empty())
+					names.emplace_back(name, kind);
+			};
+			for (size_t l = 0; l < file->text.size(); ++l)
+				names_of(
+					l < file->lines.size() ? file->lines[l] : scan_line(file->text[l]),
+					add
+				);
+			std::sort(names.begin(), names.end(), [](auto &a, auto &b) {
+				return IgnoreCaseLess()(a.first, b.first);
+			});
+		}
+		doc.included_names = std::move(included);
+	}
+	doc.edit_first = doc.edit_last = 0;
+	doc.edit_delta = 0;
+	doc.can_patch = true;
+
+	// A new parser refers to none of the retired texts, one is made once
+	// they would outnumber the lines
+	if (doc.retired.size() > doc.texts.size())
+		doc.parser.reset();
+	if (doc.parser) {
+		doc.parser->reassemble(doc.source);
+	} else {
+		doc.parser = std::make_unique<Parser>(doc.source, true);
+		doc.parser->set_reporting(false);
+		doc.parser->parse_and_assemble();
+		doc.retired.clear();
+	}
+	doc.is_assembled = true;
+	publish_diagnostics(doc);
+}
+
+void LanguageServer::publish_diagnostics(Document &doc)
+{
+	auto &src = *doc.source;
+	// Errors of the included files are published for those files
+	std::map<string, Json::Array> by_uri;
+	by_uri[doc.uri];
+	for (auto &uri : doc.diagnosed)
+		by_uri[uri];
+
+	for (auto &diag : doc.parser->diagnostics()) {
+		auto origin = src.origin_of(diag.span.line);
+		auto line = src.files[origin.file]->text[origin.line];
+		// Columns of an expanded line do not apply, mark its invocation
+		size_t beg = 0;
+		size_t end = line.size();
+		if (!origin.is_expanded) {
+			beg = std::min<size_t>(diag.span.column, line.size());
+			end = std::min<size_t>(beg + diag.span.length, line.size());
+		}
+
+		Json item;
+		item["range"] = make_range(line, origin.line, beg, end);
+		item["severity"] = SEVERITY_ERROR;
+		item["source"] = "c8asm";
+		item["message"] = diag.msg;
+		auto uri = origin.file == 0 ? doc.uri : path_to_uri(src.paths[origin.file]);
+		by_uri[uri].push_back(std::move(item));
+	}
+
+	doc.diagnosed.clear();
+	for (auto &[uri, diags] : by_uri) {
+		if (!diags.empty())
+			doc.diagnosed.insert(uri);
+		Json msg;
+		msg["jsonrpc"] = "2.0";
+		msg["method"] = "textDocument/publishDiagnostics";
+		msg["params"]["uri"] = uri;
+		msg["params"]["diagnostics"] = std::move(diags);
+		send(msg);
+	}
+}
+
+Json LanguageServer::hover(const Json &params)
+{
+	auto doc = find_document(params);
+	if (!doc)
+		return nullptr;
+	auto line_num = to_index(params["position"]["line"], doc->texts.size());
+	if (line_num == doc->texts.size())
+		return nullptr;
+	assemble(*doc);
+
+	auto &line = *doc->texts[line_num];
+	auto column = byte_column(
+		line, to_index(params["position"]["character"], line.size())
+	);
+	auto word = word_at(line, column);
+	string value;
+	char buf[64];
+
+	if (auto label = doc->parser->find_label(word)) {
+		std::snprintf(buf, sizeof(buf), "`0x%03zX`", label->addr);
+		value += "label `" + string(word) + "` at " + buf + "\n\n";
+	}
+
+	// Code of the line, including that of the macro expanded by it
+	for (auto i : doc->source->lines_of_main(static_cast<unsigned>(line_num))) {
+		auto code = doc->parser->code_of(i);
+		if (!code || code->bytes.empty())
+			continue;
+
+		std::snprintf(buf, sizeof(buf), "`0x%03zX`: `", code->addr);
+		value += buf;
+		auto shown = std::min(code->bytes.size(), HOVER_MAX_BYTES);
+		for (size_t b = 0; b < shown; ++b) {
+			// Grouped by instruction
+			if (b != 0 && b % C8_INS_LEN == 0)
+				value += ' ';
+			std::snprintf(buf, sizeof(buf), "%02X", code->bytes[b]);
+			value += buf;
+		}
+		value += '`';
+		if (shown < code->bytes.size())
+			value += " ... " + std::to_string(code->bytes.size()) + " bytes";
+		value += "\n\n";
+	}
+	if (value.empty())
+		return nullptr;
+
+	Json ret;
+	ret["contents"]["kind"] = "markdown";
+	ret["contents"]["value"] = value;
+	return ret;
+}
+
+Json LanguageServer::definition(const Json &params)
+{
+	auto doc = find_document(params);
+	if (!doc)
+		return nullptr;
+	auto line_num = to_index(params["position"]["line"], doc->texts.size());
+	if (line_num == doc->texts.size())
+		return nullptr;
+	assemble(*doc);
+
+	auto &line = *doc->texts[line_num];
+	auto column = byte_column(
+		line, to_index(params["position"]["character"], line.size())
+	);
+	auto label = doc->parser->find_label(word_at(line, column));
+	if (!label)
+		return nullptr;
+
+	auto &src = *doc->source;
+	auto origin = src.origin_of(label->span.line);
+	auto text = src.files[origin.file]->text[origin.line];
+	size_t beg = 0;
+	size_t end = text.size();
+	if (!origin.is_expanded) {
+		beg = std::min<size_t>(label->span.column, text.size());
+		end = std::min<size_t>(beg + label->span.length, text.size());
+	}
+
+	Json ret;
+	ret["uri"] = origin.file == 0 ? doc->uri : path_to_uri(src.paths[origin.file]);
+	ret["range"] = make_range(text, origin.line, beg, end);
+	return ret;
+}
+
+Json LanguageServer::completion(const Json &params)
+{
+	auto doc = find_document(params);
+	if (!doc)
+		return Json::Array{};
+	auto line_num = to_index(params["position"]["line"], doc->texts.size());
+	if (line_num == doc->texts.size())
+		return Json::Array{};
+	// Names come from the last assembly and the token cache, a keystroke
+	// is not held up by assembling. Only a document never assembled is.
+	if (!doc->parser)
+		assemble(*doc);
+
+	// Only names starting with the word being typed, so that the reply
+	// stays small for large sources.
+	auto &line = *doc->texts[line_num];
+	auto column = byte_column(
+		line, to_index(params["position"]["character"], line.size())
+	);
+	auto prefix = word_at(string_view(line).substr(0, column), column);
+	auto matches = [prefix](string_view name) {
+		return name.size() >= prefix.size()
+			   && iequals(name.substr(0, prefix.size()), prefix);
+	};
+
+	std::map<string, int, IgnoreCaseLess> items;
+	auto add = [&](string_view name, int kind) {
+		if (!name.empty() && matches(name))
+			items.emplace(name, kind);
+	};
+
+	// Names of the document come from its token cache, those of the
+	// included files from their scan and labels also from the last assembly
+	// (for those of macro expansions). Only the names with the prefix are
+	// looked at, they are next to each other in the ordering.
+	auto &names = doc->names;
+	for (auto it = names.lower_bound(prefix); it != names.end() && matches(it->first); ++it)
+		add(it->first, it->second);
+	for (auto name : doc->parser->labels_with_prefix(prefix))
+		add(name, COMPLETION_REFERENCE);
+	for (auto &kv : doc->included_names) {
+		auto &file_names = kv.second;
+		auto it = std::lower_bound(
+			file_names.begin(), file_names.end(), prefix,
+			[](const Name &n, string_view p) { return IgnoreCaseLess()(n.first, p); }
+		);
+		for (; it != file_names.end() && matches(it->first); ++it)
+			add(it->first, it->second);
+	}
+
+	auto lower = [](string_view s) {
+		string ret(s);
+		for (auto &c : ret)
+			c = std::tolower(static_cast<unsigned char>(c));
+		return ret;
+	};
+	for (auto name : INSTRUCTIONS)
+		add(lower(name), COMPLETION_KEYWORD);
+	for (auto name : DIRECTIVES)
+		add(lower(name), COMPLETION_KEYWORD);
+	for (auto name : REGISTERS)
+		add(lower(name), COMPLETION_VARIABLE);
+
+	Json::Array ret;
+	for (auto &[name, kind] : items) {
+		Json item;
+		item["label"] = name;
+		item["kind"] = kind;
+		ret.push_back(std::move(item));
+	}
+	return ret;
+}
@@ -0,0 +1,62 @@
+#ifndef ASSEMBLER_LSP_HXX_INCLUDED
+#define ASSEMBLER_LSP_HXX_INCLUDED
+
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "json.hxx"
+
+// -----------------------------------------------------------------------
+// Language server for CHIP-8 assembly, speaks LSP(JSON-RPC messages with a
+// Content-Length header) over stdin and stdout.
+// Every open document keeps each of its lines scanned(a token cache), an
+// edit scans only the lines it touches. Documents are assembled, with the
+// incremental parser, only once no more input is waiting: a burst of edits
+// is assembled once and typing is never held up by assembling. Requests
+// assemble their document first if it is out of date.
+class LanguageServer
+{
+public:
+	/// Serve on stdin and stdout
+	LanguageServer();
+	/// Serve messages read from in_fd, write the replies to out
+	LanguageServer(int in_fd, std::FILE *out);
+	~LanguageServer();
+
+	/// Serve till the client exits
+	/// @return 0 if the client asked to shut down before exiting, else 1
+	int run();
+
+private:
+	struct Document;
+
+	std::optional<std::string> read_message();
+	bool has_input();
+	void send(const Json &msg);
+	void reply(const Json &id, Json result);
+	void handle(const Json &msg);
+
+	Document *find_document(const Json &params);
+	void open(const Json &params);
+	void change(const Json &params);
+	void close(const Json &params);
+	void assemble(Document &doc);
+	void publish_diagnostics(Document &doc);
+	Json hover(const Json &params);
+	Json definition(const Json &params);
+	Json completion(const Json &params);
+
+	int in_fd;
+	std::FILE *out;
+	// Open documents by their URI
+	std::map<std::string, std::unique_ptr<Document>> documents;
+	// Bytes read from stdin which are not handled yet
+	std::string input;
+	bool is_shutdown = false;
+	bool is_exiting = false;
+};
+
+#endif // END lsp.hxx
@@ -0,0 +1,2463 @@
+// Parse CHIP-8 assembly as described in chi8.md
+// Each line is a statement, parse line by line
+
+#include <cctype>
+#include <cstdint>
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <optional>
+#include <utility>
+
+#include <unistd.h>
+
+#include "chip8.hxx"
+#include "diagnostic.hxx"
+#include "parser.hxx"
+#include "preprocessor.hxx"
+#include "scanner.hxx"
+#include "source.hxx"
+
+using std::begin;
+using std::clog;
+using std::end;
+using std::map;
+using std::nullopt;
+using std::optional;
+using std::size_t;
+using std::string;
+using std::string_view;
+using std::uint16_t;
+using std::unique_ptr;
+using std::vector;
+
+/// @brief Instructions with operand format string associated with their opcodes
+/// @note JP_V0_a is an exception
+static map<string_view, uint16_t> INS_OPCODE_MAP = {
+	{"CLS", 0x00E0},     {"RET", 0x00EE},     {"SYSa", 0x0000},
+	{"JPa", 0x1000},     {"CALLa", 0x2000},   {"SEv,b", 0x3000},
+	{"SNEv,b", 0x4000},  {"SEv,v", 0x5000},   {"LDv,b", 0x6000},
+	{"ADDv,b", 0x7000},  {"LDv,v", 0x8000},   {"ORv,v", 0x8001},
+	{"ANDv,v", 0x8002},  {"XORv,v", 0x8003},  {"ADDv,v", 0x8004},
+	{"SUBv,v", 0x8005},  {"SHRv", 0x8006},    {"SUBNv,v", 0x8007},
+	{"SHLv", 0x800E},    {"SNEv,v", 0x9000},  {"LDI,a", 0xA000},
+	{"JPV0,a", 0xB000},  {"RNDv,b", 0xC000},  {"DRWv,v,n", 0xD000},
+	{"SKPv", 0xE09E},    {"SKNPv", 0xE0A1},   {"LDv,DT", 0xF007},
+	{"LDv,K", 0xF00A},   {"LDDT,v", 0xF015},  {"LDST,v", 0xF018},
+	{"ADDI,v", 0xF01E},  {"LDF,v", 0xF029},   {"LDB,v", 0xF033},
+	{"LD[I],v", 0xF055}, {"LDv,[I]", 0xF065},
+};
+// constexpr int INS_INFO_MAX_LEN = 8;
+
+/// Parallel mode splits the source into chunks of at least these many lines,
+/// anything smaller is not worth the cost of starting a thread.
+constexpr size_t MIN_CHUNK_LINES = 4096;
+/// Chunks per job, more chunks balance the load better across threads.
+constexpr size_t CHUNKS_PER_JOB = 4;
+/// Chunk size in watch mode, only the chunks having edited lines are parsed
+/// again, so they are kept small.
+constexpr size_t WATCH_CHUNK_LINES = 64;
+/// Parse cache files start with these, files of another version are not
+/// read. Bump the version whenever what is written for a chunk changes.
+constexpr std::uint32_t PARSE_CACHE_MAGIC = 0x63703863; // "c8pc"
+constexpr std::uint32_t PARSE_CACHE_VERSION = 2;
+/// Parentheses, unary operators and function calls nested deeper than this
+/// are rejected, each level is a recursion of the expression parser
+constexpr int MAX_EXPR_DEPTH = 64;
+
+#define LOG_ERR_GET(err_msg, val) (log_err((err_msg), (this->tok_span)), (val));
+
+enum class ExprOp : uint8_t {
+	NUMBER,
+	LABEL,
+	SIZEOF,
+	// Unary
+	NEG,
+	NOT,
+	HI,
+	LO,
+	// Binary
+	ADD,
+	SUB,
+	MUL,
+	DIV,
+	MOD,
+	AND,
+	OR,
+	XOR,
+	SHL,
+	SHR,
+};
+
+struct ExprNode {
+	ExprNode(ExprOp op_, std::int64_t value_ = 0, string_view label_ = {})
+		: op(op_)
+		, value(value_)
+		, label(label_)
+	{
+	}
+
+	ExprOp op = ExprOp::NUMBER;
+	std::int64_t value = 0;
+	// For LABEL and SIZEOF
+	string_view label;
+};
+
+/// @brief Constant expression in reverse polish notation
+using Expr = std::vector<ExprNode>;
+
+enum class StmtKind : uint8_t {
+	INSTRUCTION,
+	// Byte(db) or big endian word(dw) whose value refers to labels
+	BYTE,
+	WORD,
+	// Constant bytes of db and dw, stored in the chunk's data
+	DATA,
+	// Contents of a file(incbin)
+	BINARY,
+	// Byte repeated(fill)
+	FILL,
+	// Zero bytes till the address is a multiple of the alignment
+	ALIGN,
+};
+
+struct Statement {
+	// Source line of the statement
+	unsigned line = 0;
+	StmtKind kind = StmtKind::INSTRUCTION;
+	uint16_t opcode = 0;
+	uint16_t immediate = 0;
+	// Maximum value of the immediate
+	uint16_t imm_max = 0;
+	uint8_t vx = 0;
+	uint8_t vy = 0;
+	// Immediate expression which refers to labels, it is evaluated when
+	// encoding as labels may be defined after it. Empty if not needed.
+	Expr expr;
+	Span expr_span;
+	// DATA: offset in the chunk's data, BINARY: index of the chunk's file,
+	// ALIGN: the alignment
+	std::uint32_t index = 0;
+	// Bytes of DATA, BINARY and FILL, padding of ALIGN(set by layout)
+	std::uint32_t size = 0;
+};
+
+/// @brief Label definition, address is relative to the start of its chunk
+struct Label {
+	string_view name;
+	// Excluding the padding of the align directives before it
+	size_t offset = 0;
+	Span span;
+	// Align directives before it in the chunk
+	unsigned aligns = 0;
+};
+
+enum class Tok {
+	ERROR,
+	END,
+	DIREC_DB,
+	DIREC_DW,
+	DIREC_FILL,
+	DIREC_ALIGN,
+	DIREC_INCBIN,
+	DIREC_DEFINE,
+	INSTRUCTION,
+	REGISTER,
+	IDENTIFIER,
+	IMMEDIATE,
+	CHAR,
+};
+
+// -----------------------------------------------------------------------
+// Parses a contiguous range(chunk) of lines, line by line, case-insesetive.
+// Chunks are independent of each other given the defines visible at their
+// start, so that they can be parsed in parallel.
+class ChunkParser
+{
+public:
+	/// @param source_ Preprocessed source of the lines, for the paths of
+	/// included binaries, if null they are relative to the working directory
+	/// @param map_files_ Passed on to SourceFile for included binaries
+	ChunkParser(
+		std::vector<string_view> &source_lines,
+		const Preprocessed *source_ = nullptr, bool map_files_ = true
+	)
+		: lines(source_lines)
+		, source(source_)
+		, map_files(map_files_)
+	{
+	}
+
+	/// Parse lines [first, last), each line is replaced by its expansion
+	void parse_lines(size_t first, size_t last);
+	/// Lines were inserted or removed before the chunk, renumber its lines
+	void shift_lines(std::ptrdiff_t delta);
+	/// Only evaluate the define directives in lines [first, last) and
+	/// track the defines which are visible after them, nothing is recorded.
+	/// @return false if a substitution can expand into a define directive,
+	/// then the defines cannot be found without parsing every line.
+	bool scan_defines(size_t first, size_t last);
+	/// Place the chunk at base, align directives are sized for it
+	/// @return Size of the chunk
+	size_t layout(size_t base);
+	/// Offset of the label from the start of the chunk, after layout
+	size_t offset_of(const Label &label) const;
+	/// Write the results of the chunk, parsed from the lines of a file whose
+	/// contents are text, to a parse cache file. Nothing is written if the
+	/// chunk has errors or incbin, or refers to anything but text.
+	/// @param identifiers Sorted identifiers of text, see identifiers_of()
+	void save_parsed(
+		const string &path, string_view text, size_t first,
+		const vector<string_view> &identifiers
+	) const;
+	/// Take the results from a parse cache file written for a file with the
+	/// same contents, instead of parsing the lines [first, last).
+	/// @return false if the file cannot be used, nothing is changed then
+	bool load_parsed(
+		const string &path, string_view text, size_t first, size_t last
+	);
+
+	// Define substitution map
+	std::map<string_view, string_view, IgnoreCaseLess> define_map;
+	// Results of parsing the chunk
+	std::vector<Statement> statements;
+	std::vector<Label> labels;
+	std::vector<Diagnostic> diagnostics;
+	// Constant bytes of db and dw directives, and the included binaries
+	std::vector<uint8_t> data;
+	std::vector<std::shared_ptr<const SourceFile>> binaries;
+	// Paths of all incbin directives, even those which cannot be read
+	std::vector<string> binary_paths;
+	// Size of the code generated for the chunk so far, without the padding
+	// of align directives, and the size after layout.
+	size_t label_addr = 0;
+	size_t code_size = 0;
+
+private:
+	// Replace macros with their associated expansions
+	string_view perform_replacements(string_view line);
+	Tok parse_immediate();
+	Tok parse_identifier();
+	Tok next_token();
+	Tok next_token_impl();
+	optional<int> parse_define();
+	bool at_expression();
+	bool parse_expression(Expr &expr, int min_prec = 0, int depth = 0);
+	bool parse_unary(Expr &expr, int depth);
+	bool parse_operand(Statement &stmt, uint16_t imm_max);
+	optional<std::int64_t> parse_constant(string_view what);
+	bool at_comma();
+	bool parse_data(bool is_word);
+	optional<Statement> parse_fill();
+	optional<Statement> parse_align();
+	optional<Statement> parse_incbin();
+	optional<Statement> parse_instruction();
+	optional<Statement> parse_line(string_view line);
+	void log_err(std::string_view msg, Span span);
+
+	// Source split up into lines, shared by all the chunks
+	std::vector<string_view> &lines;
+	const Preprocessed *source = nullptr;
+	bool map_files = true;
+	// Total padding after each align directive, [0] is none
+	std::vector<size_t> padding;
+	// Storage for lines which had replacements performed on them
+	std::deque<std::string> expansions;
+	// Current line after replacements
+	string_view cur_line;
+	// Substitution of the last define directive
+	string_view last_subst;
+	// Scanner for the current line
+	Scanner scn;
+	/// Last token position
+	Span tok_span;
+
+	// Absolute immediate value or register index
+	std::uint16_t number = 0;
+	std::string_view identifier;
+	char character = '\0';
+
+	size_t line_num = 0;
+	unsigned align_cnt = 0;
+	int error_cnt = 0;
+};
+
+/// @brief Run task(i) for every i in [0, n) on up to jobs threads.
+/// Tasks are picked up in order by whichever thread is free.
+template <typename Task>
+static void parallel_for(size_t n, unsigned jobs, Task task)
+{
+	std::atomic<size_t> next{0};
+	auto worker = [&]() {
+		for (size_t i; (i = next.fetch_add(1)) < n;)
+			task(i);
+	};
+
+	vector<std::thread> threads;
+	for (unsigned i = 1; i < std::min<size_t>(jobs, n); ++i)
+		threads.emplace_back(worker);
+	// The calling thread works too
+	worker();
+	for (auto &t : threads)
+		t.join();
+}
+
+// ctype functions take the value of an unsigned char, bytes of UTF-8 are
+// negative chars
+static inline bool is_blank(char c)
+{
+	return std::isblank(static_cast<unsigned char>(c));
+}
+static inline bool is_digit(char c)
+{
+	return std::isdigit(static_cast<unsigned char>(c));
+}
+static inline bool is_ident_char(char c)
+{
+	return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+// For digits of base 2-36, if return > desired_base then invalid char
+static uint16_t char_to_uint(char c)
+{
+	c = std::toupper(static_cast<unsigned char>(c));
+	if ('0' <= c && c <= '9')
+		return c - '0';
+	else if ('A' <= c && c <= 'Z')
+		return c - 'A' + 10;
+	else
+		return UINT16_MAX;
+}
+
+static inline bool is_reserved_name(string_view s)
+{
+	// Name of internal registers(non V's) used by assembly
+	for (auto name : {"F", "B", "I", "K", "DT", "ST"}) {
+		if (iequals(s, name))
+			return true;
+	}
+	return false;
+}
+
+string_view ChunkParser::perform_replacements(string_view line)
+{
+	if (define_map.empty())
+		return line;
+
+	string processed;
+	bool replaced = false;
+	scn = Scanner(line);
+
+	while (!scn.is_at_end()) {
+		auto other = scn.skip_while([](char c) { return !is_ident_char(c); });
+		auto maybe_ident = scn.skip_while(is_ident_char);
+		// Neither skips a NUL, it is kept as it is
+		if (other.empty() && maybe_ident.empty()) {
+			other = line.substr(scn.cursor(), 1);
+			scn.skip();
+		}
+
+		// If present in the define map, then append the expansion of the
+		// define macro to the new string. The new string is only built
+		// once the first replacement is found, until then it is unused.
+		auto result = define_map.find(maybe_ident);
+		if (!replaced) {
+			if (result == define_map.end())
+				continue;
+			// Everything before this identifier is kept as it is
+			processed = line.substr(0, maybe_ident.data() - line.data());
+			replaced = true;
+		} else {
+			processed += other;
+		}
+
+		if (result != define_map.end())
+			processed += result->second;
+		else
+			processed += maybe_ident;
+	}
+
+	if (!replaced)
+		return line;
+	return expansions.emplace_back(std::move(processed));
+}
+
+Tok ChunkParser::parse_immediate()
+{
+	uint16_t base = 10;
+	std::uint32_t value = 0;
+
+	if (scn.first() == '0') {
+		char sec = std::toupper(static_cast<unsigned char>(scn.second()));
+		if (sec == 'X')
+			base = 16;
+		else if (sec == 'B')
+			base = 2;
+		if (base != 10)
+			scn.skip(2);
+	}
+
+	while (auto c = scn.first()) {
+		if (!std::isalnum(static_cast<unsigned char>(c)))
+			break;
+		auto dig = char_to_uint(c);
+		// Errors span the token up to the digit, next_token() only sets the
+		// length once the token is read
+		tok_span.length = scn.cursor() + 1 - tok_span.column;
+		if (dig >= base)
+			return LOG_ERR_GET("Illegal character in immediate", Tok::ERROR);
+		// Wider than number, so that it cannot wrap around
+		value = value * base + dig;
+		if (value > UINT16_MAX)
+			return LOG_ERR_GET("Integer overflow", Tok::ERROR);
+
+		scn.skip();
+	}
+
+	number = value;
+	return Tok::IMMEDIATE;
+}
+
+Tok ChunkParser::parse_identifier()
+{
+	identifier = scn.skip_while(is_ident_char);
+
+	auto is_ident = [this](string_view s) { return iequals(s, identifier); };
+
+	// Check if: Directive
+	if (is_ident("DB"))
+		return Tok::DIREC_DB;
+	if (is_ident("DW"))
+		return Tok::DIREC_DW;
+	if (is_ident("FILL"))
+		return Tok::DIREC_FILL;
+	if (is_ident("ALIGN"))
+		return Tok::DIREC_ALIGN;
+	if (is_ident("INCBIN"))
+		return Tok::DIREC_INCBIN;
+	if (is_ident("DEFINE"))
+		return Tok::DIREC_DEFINE;
+
+	// Check if: Instruction
+	auto ins = std::find_if(begin(INSTRUCTIONS), end(INSTRUCTIONS), is_ident);
+	if (ins != end(INSTRUCTIONS))
+		return Tok::INSTRUCTION;
+
+	// Check if: Register
+	auto reg = std::find_if(begin(REGISTERS), end(REGISTERS), is_ident);
+	if (reg != end(REGISTERS)) {
+		number = reg - begin(REGISTERS);
+		return Tok::REGISTER;
+	}
+
+	return Tok::IDENTIFIER;
+}
+
+Tok ChunkParser::next_token_impl()
+{
+	tok_span.line = line_num;
+	tok_span.column = scn.cursor();
+
+	while (auto c = scn.first()) {
+		if (is_digit(c)) {
+			return parse_immediate();
+		} else if (is_ident_char(c)) {
+			return parse_identifier();
+		} else if (is_blank(c)) {
+			scn.skip();
+			tok_span.column = scn.cursor();
+		} else if (c == ';') {
+			scn.skip_while([](char ch) { return ch != '\n'; });
+		} else {
+			scn.skip();
+			character = c;
+			return Tok::CHAR;
+		}
+	}
+
+	return Tok::END;
+}
+
+Tok ChunkParser::next_token()
+{
+	auto ret = next_token_impl();
+	tok_span.length = scn.cursor() - tok_span.column;
+	return ret;
+}
+
+optional<int> ChunkParser::parse_define()
+{
+	scn.skip_while(is_blank);
+	if (next_token() != Tok::IDENTIFIER)
+		return LOG_ERR_GET("Expected alias for define", nullopt);
+	auto alias = identifier;
+
+	// Skip the blanks after the alias and then take everything
+	// present till the the end-of-line.
+	scn.skip_while(is_blank);
+	auto subst = scn.skip_while([](char c) { return c != '\n'; });
+	if (subst.empty())
+		return LOG_ERR_GET("Expected substituion for define", nullopt);
+
+	define_map[alias] = last_subst = subst;
+	return alias.size();
+}
+
+/// @brief Evaluate an expression, resolve(node) gives the value of the
+/// LABEL and SIZEOF nodes or nullopt if the label is not found.
+/// @return nullopt on failure, error message is set
+template <typename Resolve>
+static optional<std::int64_t>
+evaluate(const Expr &expr, Resolve resolve, string &err)
+{
+	using std::int64_t;
+	using std::uint64_t;
+	vector<int64_t> stack;
+
+	for (auto &node : expr) {
+		int64_t rhs = 0;
+		if (node.op >= ExprOp::ADD) {
+			rhs = stack.back();
+			stack.pop_back();
+		}
+		// Wraps around, instead of overflowing
+		auto lhs = stack.empty() ? 0 : uint64_t(stack.back());
+
+		switch (node.op) {
+		case ExprOp::NUMBER:
+			stack.push_back(node.value);
+			continue;
+		case ExprOp::LABEL:
+		case ExprOp::SIZEOF:
+			if (auto val = resolve(node)) {
+				stack.push_back(*val);
+				continue;
+			}
+			err = "Label not found: " + string(node.label);
+			return nullopt;
+
+		case ExprOp::NEG:
+			lhs = -lhs;
+			break;
+		case ExprOp::NOT:
+			lhs = ~lhs;
+			break;
+		case ExprOp::HI:
+			lhs = (lhs >> 8) & C8_BYTE_MAX;
+			break;
+		case ExprOp::LO:
+			lhs = lhs & C8_BYTE_MAX;
+			break;
+
+		case ExprOp::ADD:
+			lhs += rhs;
+			break;
+		case ExprOp::SUB:
+			lhs -= rhs;
+			break;
+		case ExprOp::MUL:
+			lhs *= rhs;
+			break;
+		case ExprOp::DIV:
+		case ExprOp::MOD:
+			if (rhs == 0) {
+				err = "Division by zero";
+				return nullopt;
+			}
+			if (rhs == -1) // Avoid INT64_MIN / -1
+				lhs = node.op == ExprOp::DIV ? -lhs : 0;
+			else if (node.op == ExprOp::DIV)
+				lhs = int64_t(lhs) / rhs;
+			else
+				lhs = int64_t(lhs) % rhs;
+			break;
+		case ExprOp::AND:
+			lhs &= rhs;
+			break;
+		case ExprOp::OR:
+			lhs |= rhs;
+			break;
+		case ExprOp::XOR:
+			lhs ^= rhs;
+			break;
+		case ExprOp::SHL:
+		case ExprOp::SHR:
+			if (rhs < 0 || rhs > 63) {
+				err = "Shift amount out of range";
+				return nullopt;
+			}
+			if (node.op == ExprOp::SHL)
+				lhs <<= rhs;
+			else
+				lhs = int64_t(lhs) >> rhs;
+			break;
+		}
+		stack.back() = lhs;
+	}
+
+	return stack.back();
+}
+
+static bool refers_labels(const Expr &expr)
+{
+	return std::any_of(expr.begin(), expr.end(), [](const ExprNode &node) {
+		return node.op == ExprOp::LABEL || node.op == ExprOp::SIZEOF;
+	});
+}
+
+/// @brief Check if the value fits in an operand, negative values are only
+/// allowed for bytes and words and are converted to their 2's complement.
+static optional<uint16_t> fit_operand(std::int64_t val, uint16_t imm_max)
+{
+	if (val < 0 && imm_max == C8_BYTE_MAX && val >= INT8_MIN)
+		return val & C8_BYTE_MAX;
+	if (val < 0 && imm_max == C8_WORD_MAX && val >= INT16_MIN)
+		return val & C8_WORD_MAX;
+	if (val < 0 || val > imm_max)
+		return nullopt;
+	return val;
+}
+
+bool ChunkParser::at_expression()
+{
+	scn.skip_while(is_blank);
+	auto c = scn.first();
+	if (is_digit(c) || c == '-' || c == '+' || c == '~' || c == '(')
+		return true;
+	if (!is_ident_char(c))
+		return false;
+
+	// Everything except registers and reserved names are labels
+	auto peek = scn;
+	auto word = peek.skip_while(is_ident_char);
+	auto is_word = [word](string_view s) { return iequals(s, word); };
+	return std::none_of(begin(REGISTERS), end(REGISTERS), is_word)
+		   && !is_reserved_name(word);
+}
+
+bool ChunkParser::parse_unary(Expr &expr, int depth)
+{
+	scn.skip_while(is_blank);
+	if (depth > MAX_EXPR_DEPTH) {
+		tok_span.line = line_num;
+		tok_span.column = scn.cursor();
+		tok_span.length = 1;
+		return LOG_ERR_GET("Expression is nested too deeply", false);
+	}
+
+	// Unary operators apply to the operand after them
+	if (auto c = scn.first(); c == '-' || c == '+' || c == '~') {
+		scn.skip();
+		if (!parse_unary(expr, depth + 1))
+			return false;
+		if (c != '+')
+			expr.push_back({c == '-' ? ExprOp::NEG : ExprOp::NOT});
+		return true;
+	}
+
+	auto expect_char = [this](char ch) {
+		return next_token() == Tok::CHAR && character == ch;
+	};
+
+	switch (next_token()) {
+	case Tok::IMMEDIATE:
+		expr.push_back({ExprOp::NUMBER, number});
+		return true;
+
+	case Tok::CHAR:
+		if (character != '(')
+			break;
+		if (!parse_expression(expr, 0, depth + 1))
+			return false;
+		if (!expect_char(')'))
+			return LOG_ERR_GET("Expected ')'", false);
+		return true;
+
+	case Tok::IDENTIFIER: {
+		auto name = identifier;
+		// Not a function call, then it is a label
+		scn.skip_while(is_blank);
+		if (scn.first() != '(') {
+			expr.push_back({ExprOp::LABEL, 0, name});
+			return true;
+		}
+		scn.skip();
+
+		if (iequals(name, "SIZEOF")) {
+			if (next_token() != Tok::IDENTIFIER)
+				return LOG_ERR_GET("Expected label for sizeof", false);
+			expr.push_back({ExprOp::SIZEOF, 0, identifier});
+		} else if (iequals(name, "HI") || iequals(name, "LO")) {
+			if (!parse_expression(expr, 0, depth + 1))
+				return false;
+			expr.push_back({iequals(name, "HI") ? ExprOp::HI : ExprOp::LO});
+		} else {
+			return LOG_ERR_GET("Unknown function", false);
+		}
+
+		if (!expect_char(')'))
+			return LOG_ERR_GET("Expected ')'", false);
+		return true;
+	}
+
+	case Tok::ERROR:
+		return false;
+
+	default:
+		break;
+	}
+
+	return LOG_ERR_GET("Expected expression", false);
+}
+
+bool ChunkParser::parse_expression(Expr &expr, int min_prec, int depth)
+{
+	struct BinaryOp {
+		string_view symbol;
+		ExprOp op;
+		int prec;
+	};
+	// Ordered so that longer symbols are matched first
+	constexpr BinaryOp BINARY_OPS[] = {
+		{"<<", ExprOp::SHL, 4}, {">>", ExprOp::SHR, 4}, {"|", ExprOp::OR, 1},
+		{"^", ExprOp::XOR, 2},  {"&", ExprOp::AND, 3},  {"+", ExprOp::ADD, 5},
+		{"-", ExprOp::SUB, 5},  {"*", ExprOp::MUL, 6},  {"/", ExprOp::DIV, 6},
+		{"%", ExprOp::MOD, 6},
+	};
+
+	if (!parse_unary(expr, depth))
+		return false;
+
+	// Precedence climbing, all binary operators are left associative
+	while (true) {
+		scn.skip_while(is_blank);
+		char next[] = {scn.first(), scn.second()};
+		auto found = std::find_if(
+			begin(BINARY_OPS), end(BINARY_OPS), [&next](const BinaryOp &b) {
+				return string_view(next, b.symbol.size()) == b.symbol;
+			}
+		);
+		if (found == end(BINARY_OPS) || found->prec < min_prec)
+			return true;
+
+		scn.skip(found->symbol.size());
+		if (!parse_expression(expr, found->prec + 1, depth))
+			return false;
+		expr.push_back({found->op});
+	}
+}
+
+bool ChunkParser::parse_operand(Statement &stmt, uint16_t imm_max)
+{
+	scn.skip_while(is_blank);
+	auto span = Span{unsigned(line_num), unsigned(scn.cursor()), 0};
+
+	Expr expr;
+	if (!parse_expression(expr))
+		return false;
+	span.length = scn.cursor() - span.column;
+	tok_span = span;
+	stmt.imm_max = imm_max;
+
+	// Labels may not be defined yet, so they are evaluated when encoding
+	if (refers_labels(expr)) {
+		stmt.expr = std::move(expr);
+		stmt.expr_span = span;
+		return true;
+	}
+
+	string err;
+	auto no_labels = [](const ExprNode &) -> optional<std::int64_t> {
+		return nullopt;
+	};
+	auto val = evaluate(expr, no_labels, err);
+	if (!val)
+		return LOG_ERR_GET(err, false);
+	auto imm = fit_operand(*val, imm_max);
+	if (!imm)
+		return LOG_ERR_GET("Immediate out of range", false);
+
+	stmt.immediate = *imm;
+	return true;
+}
+
+optional<std::int64_t> ChunkParser::parse_constant(string_view what)
+{
+	scn.skip_while(is_blank);
+	auto span = Span{unsigned(line_num), unsigned(scn.cursor()), 0};
+
+	Expr expr;
+	if (!parse_expression(expr))
+		return nullopt;
+	span.length = scn.cursor() - span.column;
+	tok_span = span;
+
+	// Size of the code cannot depend on labels
+	if (refers_labels(expr))
+		return LOG_ERR_GET(string(what) + " cannot refer to labels", nullopt);
+	string err;
+	auto no_labels = [](const ExprNode &) -> optional<std::int64_t> {
+		return nullopt;
+	};
+	auto val = evaluate(expr, no_labels, err);
+	if (!val)
+		return LOG_ERR_GET(err, nullopt);
+	return val;
+}
+
+bool ChunkParser::at_comma()
+{
+	scn.skip_while(is_blank);
+	if (scn.first() != ',')
+		return false;
+	scn.skip();
+	return true;
+}
+
+// Directives which generate several statements push them directly
+bool ChunkParser::parse_data(bool is_word)
+{
+	uint16_t imm_max = is_word ? C8_WORD_MAX : C8_BYTE_MAX;
+	size_t size = is_word ? 2 : 1;
+	if (!at_expression())
+		return LOG_ERR_GET(
+			is_word ? "Expected immediate after dw" : "Expected immediate after db",
+			false
+		);
+
+	// Runs of constant values are kept as a single statement
+	Statement run{};
+	run.line = line_num;
+	run.kind = StmtKind::DATA;
+	run.index = data.size();
+	auto end_run = [this, &run] {
+		if (run.size != 0)
+			statements.push_back(run);
+		run.index = data.size();
+		run.size = 0;
+	};
+
+	do {
+		Statement value{};
+		if (!parse_operand(value, imm_max)) {
+			end_run();
+			return false;
+		}
+		label_addr += size;
+
+		if (!value.expr.empty()) {
+			end_run();
+			value.line = line_num;
+			value.kind = is_word ? StmtKind::WORD : StmtKind::BYTE;
+			statements.push_back(std::move(value));
+			continue;
+		}
+		if (is_word)
+			data.push_back(value.immediate >> 8);
+		data.push_back(value.immediate & 0xFF);
+		run.size += size;
+	} while (at_comma());
+
+	end_run();
+	return true;
+}
+
+optional<Statement> ChunkParser::parse_fill()
+{
+	auto count = parse_constant("Fill count");
+	if (!count)
+		return nullopt;
+	if (*count < 0 || *count > C8_RAM_SIZE)
+		return LOG_ERR_GET("Fill count out of range", nullopt);
+	if (!at_comma())
+		return LOG_ERR_GET("Expected ',' after fill count", nullopt);
+
+	Statement ret{};
+	if (!parse_operand(ret, C8_BYTE_MAX))
+		return nullopt;
+	ret.kind = StmtKind::FILL;
+	ret.size = *count;
+	label_addr += ret.size;
+	return ret;
+}
+
+optional<Statement> ChunkParser::parse_align()
+{
+	auto alignment = parse_constant("Alignment");
+	if (!alignment)
+		return nullopt;
+	if (*alignment < 1 || *alignment > C8_RAM_SIZE)
+		return LOG_ERR_GET("Alignment out of range", nullopt);
+
+	// Padding depends on the address, which is known only after layout
+	Statement ret{};
+	ret.kind = StmtKind::ALIGN;
+	ret.index = *alignment;
+	align_cnt++;
+	return ret;
+}
+
+optional<Statement> ChunkParser::parse_incbin()
+{
+	scn.skip_while(is_blank);
+	tok_span.column = scn.cursor();
+	tok_span.length = 6;
+	if (scn.first() != '"')
+		return LOG_ERR_GET("Expected quoted file name after incbin", nullopt);
+	scn.skip();
+	auto name = scn.skip_while([](char c) { return c != '"'; });
+	if (scn.first() != '"')
+		return LOG_ERR_GET("Expected quoted file name after incbin", nullopt);
+	scn.skip();
+	tok_span.column++;
+	tok_span.length = name.size();
+
+	// Relative to the file which has the line, like includes
+	auto path = source ? source->resolve_path(source->origin_of(line_num).file, name)
+					   : string(name);
+	binary_paths.push_back(path);
+	auto file = std::make_shared<const SourceFile>(path.c_str(), map_files);
+	if (!*file)
+		return LOG_ERR_GET("Cannot open file '" + path + "'", nullopt);
+	if (file->text().size() > C8_RAM_SIZE)
+		return LOG_ERR_GET("File does not fit in memory", nullopt);
+
+	Statement ret{};
+	ret.kind = StmtKind::BINARY;
+	ret.index = binaries.size();
+	ret.size = file->text().size();
+	binaries.push_back(std::move(file));
+	label_addr += ret.size;
+	return ret;
+}
+
+static bool is_ins_info_valid(string_view ins_info)
+{
+	for (const auto &kv : INS_OPCODE_MAP) {
+		if (kv.first.substr(0, ins_info.size()) == ins_info)
+			return true;
+	}
+	return false;
+}
+
+optional<Statement> ChunkParser::parse_instruction()
+{
+	Statement ret{};
+	string ins_info;
+	bool is_reg_vx = true;
+
+	// Pattern strings are uppercase, source identifiers may not be
+	auto append_upper = [&ins_info](string_view s) {
+		for (auto c : s)
+			ins_info += std::toupper(static_cast<unsigned char>(c));
+	};
+	append_upper(identifier);
+
+	auto insop_map_has = [](string_view s) -> bool {
+		return INS_OPCODE_MAP.find(s) != INS_OPCODE_MAP.end();
+	};
+
+	// Construct the Instruction-Operand pattern string and match
+	while (1) {
+		auto complete = INS_OPCODE_MAP.find(ins_info);
+		if (complete != INS_OPCODE_MAP.end()) {
+			ret.opcode = complete->second;
+			return ret;
+		}
+		if (!is_ins_info_valid(ins_info))
+			return LOG_ERR_GET("Illegal Token", nullopt);
+
+		// Immediate is a terminal operand, it is a constant expression
+		// which can refer to labels.
+		if (at_expression()) {
+			uint16_t imm_max = 0;
+			tok_span.column = scn.cursor();
+			tok_span.length = 1;
+
+			// Ony DRW has nibble as its last argument
+			if (ins_info == "DRWv,v,") {
+				imm_max = C8_NIBBLE_MAX;
+				ins_info += 'n';
+			} else if (insop_map_has(ins_info + 'a')) {
+				imm_max = C8_ADDR_MAX;
+				ins_info += 'a';
+			} else if (insop_map_has(ins_info + 'b')) {
+				imm_max = C8_BYTE_MAX;
+				ins_info += 'b';
+			} else {
+				return LOG_ERR_GET("Unexpected immediate", nullopt);
+			}
+
+			if (!parse_operand(ret, imm_max))
+				return nullopt;
+			continue;
+		}
+
+		switch (next_token()) {
+		case Tok::IDENTIFIER:
+			// Reserved names, like: I, DT, ST
+			append_upper(identifier);
+			break;
+
+		case Tok::REGISTER:
+			// Exception: JP V0, addr; Has V0 as a fixed operand
+			if (ins_info == "JP" && number == 0) {
+				ins_info += "V0";
+				break;
+			}
+			// When a register is encountered for the first time it is vx,
+			// so use it and mark that vx is no longer empty via is_reg_vx.
+			// And after that if any register is encountered we use vy.
+			if (is_reg_vx) {
+				ret.vx = number;
+				is_reg_vx = false;
+			} else {
+				ret.vy = number;
+			}
+			ins_info += 'v';
+			break;
+
+		case Tok::CHAR:
+			ins_info += character;
+			break;
+
+		case Tok::END:
+			return LOG_ERR_GET("Unexpected end of line", nullopt);
+
+		case Tok::ERROR:
+			return nullopt;
+
+		default:
+			return LOG_ERR_GET("Unexpected token", nullopt);
+		}
+	}
+
+	return LOG_ERR_GET("This should not happen", nullopt);
+}
+
+optional<Statement> ChunkParser::parse_line(string_view line)
+{
+	line = cur_line = perform_replacements(line);
+
+	scn = Scanner(line);
+	Statement ret{};
+
+	while (true) {
+		auto tok = next_token();
+
+		switch (tok) {
+		case Tok::ERROR:
+		case Tok::END:
+			return nullopt;
+
+		case Tok::DIREC_DB:
+		case Tok::DIREC_DW:
+			parse_data(tok == Tok::DIREC_DW);
+			return nullopt;
+
+		case Tok::DIREC_FILL:
+			return parse_fill();
+
+		case Tok::DIREC_ALIGN:
+			return parse_align();
+
+		case Tok::DIREC_INCBIN:
+			return parse_incbin();
+
+		case Tok::DIREC_DEFINE:
+			parse_define();
+			// Define directive produces no code, so nullopt
+			return nullopt;
+
+		case Tok::INSTRUCTION: {
+			label_addr += C8_INS_LEN;
+			// Invalid instruction still takes its space, so that the code
+			// after it is at the addresses its labels have.
+			auto ins = parse_instruction();
+			return ins ? ins : Statement{};
+		}
+
+		case Tok::REGISTER:
+			return LOG_ERR_GET("Unexpected register name", nullopt);
+
+		case Tok::IDENTIFIER: {
+			if (is_reserved_name(identifier))
+				return LOG_ERR_GET("Label cannot be a reserved name", nullopt);
+			// The label is at its name, not at the colon read next
+			Span name_span = tok_span;
+			if (!(next_token() == Tok::CHAR && character == ':'))
+				return LOG_ERR_GET("Expected colon after label name", nullopt);
+			// Duplicates are found once labels of all chunks are merged
+			labels.push_back({identifier, label_addr, name_span, align_cnt});
+			break;
+		}
+
+		case Tok::IMMEDIATE:
+			return LOG_ERR_GET("Unexpected immediate name", nullopt);
+
+		case Tok::CHAR: {
+			string char_repr;
+			// If the character is not printable then print it's integral value
+			if (std::isprint(static_cast<unsigned char>(character))) {
+				char_repr = "'" + string({character}) + "'";
+			} else {
+				char_repr =
+					string("<?? (") + std::to_string(int(character)) + ")>";
+			}
+
+			return LOG_ERR_GET("Unexpected character " + char_repr, nullopt);
+		}
+		}
+	}
+}
+
+void ChunkParser::parse_lines(size_t first, size_t last)
+{
+	// At most a statement a line for most of them, growing a vector of a
+	// big chunk by doubling it would hold both copies at once
+	statements.reserve(statements.size() + (last - first));
+	for (line_num = first; line_num != last; ++line_num) {
+		auto prev_error_cnt = error_cnt;
+		auto stmt = parse_line(lines[line_num]);
+
+		// A tokens must be parsed before hitting the end of line(denoted by STOP)
+		if (prev_error_cnt == error_cnt && next_token() != Tok::END)
+			log_err("Unexpected stray token(s) after statement", tok_span);
+
+		if (stmt) {
+			stmt->line = line_num;
+			statements.push_back(std::move(*stmt));
+		}
+		// Keep the expansion, errors found later refer to it
+		lines[line_num] = cur_line;
+	}
+}
+
+void ChunkParser::shift_lines(std::ptrdiff_t delta)
+{
+	for (auto &stmt : statements) {
+		stmt.line += delta;
+		stmt.expr_span.line += delta;
+	}
+	for (auto &label : labels)
+		label.span.line += delta;
+	for (auto &diag : diagnostics)
+		diag.span.line += delta;
+}
+
+static bool mentions_define(string_view s)
+{
+	constexpr string_view DEFINE = "DEFINE";
+	for (size_t i = 0; i + DEFINE.size() <= s.size(); ++i) {
+		if (iequals(s.substr(i, DEFINE.size()), DEFINE))
+			return true;
+	}
+	return false;
+}
+
+bool ChunkParser::scan_defines(size_t first, size_t last)
+{
+	for (line_num = first; line_num != last; ++line_num) {
+		if (!mentions_define(lines[line_num]))
+			continue;
+
+		last_subst = {};
+		parse_line(lines[line_num]);
+		if (mentions_define(last_subst))
+			return false;
+	}
+
+	// Nothing else is of interest, the chunk parsers will find them again
+	statements.clear();
+	labels.clear();
+	diagnostics.clear();
+	return true;
+}
+
+static size_t statement_size(const Statement &stmt)
+{
+	switch (stmt.kind) {
+	case StmtKind::INSTRUCTION:
+	case StmtKind::WORD:
+		return C8_INS_LEN;
+	case StmtKind::BYTE:
+		return 1;
+	default:
+		return stmt.size;
+	}
+}
+
+size_t ChunkParser::layout(size_t base)
+{
+	if (align_cnt == 0)
+		return code_size = label_addr;
+
+	padding.assign(1, 0);
+	size_t addr = base;
+	for (auto &stmt : statements) {
+		if (stmt.kind == StmtKind::ALIGN) {
+			stmt.size = (stmt.index - addr % stmt.index) % stmt.index;
+			padding.push_back(padding.back() + stmt.size);
+		}
+		addr += statement_size(stmt);
+	}
+	return code_size = addr - base;
+}
+
+size_t ChunkParser::offset_of(const Label &label) const
+{
+	return label.offset + (label.aligns ? padding[label.aligns] : 0);
+}
+
+/// @brief Every identifier of the text, sorted and without duplicates.
+/// Split like perform_replacements() does, so a define of any other name
+/// does not change the text.
+static vector<string_view> identifiers_of(string_view text)
+{
+	vector<string_view> ret;
+	for (size_t i = 0; i < text.size();) {
+		if (!is_ident_char(text[i])) {
+			i++;
+			continue;
+		}
+		auto beg = i;
+		while (i < text.size() && is_ident_char(text[i]))
+			i++;
+		// Aliases are never numbers
+		if (!is_digit(text[beg]))
+			ret.push_back(text.substr(beg, i - beg));
+	}
+
+	std::sort(ret.begin(), ret.end(), IgnoreCaseLess());
+	ret.erase(std::unique(ret.begin(), ret.end(), iequals), ret.end());
+	return ret;
+}
+
+/// @brief Whether a define renames any of the identifiers
+static bool renames_any(
+	const map<string_view, string_view, IgnoreCaseLess> &define_map,
+	const vector<string_view> &identifiers
+)
+{
+	return std::any_of(define_map.begin(), define_map.end(), [&](auto &kv) {
+		return std::binary_search(
+			identifiers.begin(), identifiers.end(), kv.first, IgnoreCaseLess()
+		);
+	});
+}
+
+static bool is_label_node(const ExprNode &node)
+{
+	return node.op == ExprOp::LABEL || node.op == ExprOp::SIZEOF;
+}
+
+/// @brief Values appended in the byte order of the host, the cache is not
+/// meant to be moved to other machines. Views are written as their offset
+/// and size in the text of the file, lines relative to its first line.
+struct CacheWriter {
+	string_view text;
+	size_t first = 0;
+	string out;
+	// Unset once a view is not in the text
+	bool ok = true;
+
+	template <typename T>
+	void put(T val)
+	{
+		out.append(reinterpret_cast<const char *>(&val), sizeof(val));
+	}
+
+	void put_view(string_view view)
+	{
+		std::less_equal<const char *> le;
+		if (!le(text.data(), view.data())
+			|| !le(view.data() + view.size(), text.data() + text.size())) {
+			ok = false;
+			return;
+		}
+		put<std::uint32_t>(view.data() - text.data());
+		put<std::uint32_t>(view.size());
+	}
+
+	void put_span(Span span)
+	{
+		put<std::uint32_t>(span.line - first);
+		put<std::uint32_t>(span.column);
+		put<std::uint32_t>(span.length);
+	}
+};
+
+/// @brief Reads what CacheWriter wrote, checking every value which could
+/// make the parser read out of bounds.
+struct CacheReader {
+	string_view in;
+	string_view text;
+	size_t first = 0;
+	size_t line_cnt = 0;
+	// Unset once anything is out of bounds
+	bool ok = true;
+
+	template <typename T>
+	T get()
+	{
+		T val{};
+		if (in.size() < sizeof(val)) {
+			ok = false;
+			return val;
+		}
+		std::memcpy(&val, in.data(), sizeof(val));
+		in.remove_prefix(sizeof(val));
+		return val;
+	}
+
+	/// Count of items of at least item_size bytes, which must all be there
+	std::uint32_t get_count(size_t item_size)
+	{
+		auto n = get<std::uint32_t>();
+		if (n > in.size() / item_size)
+			ok = false;
+		return ok ? n : 0;
+	}
+
+	string_view get_view()
+	{
+		auto offset = get<std::uint32_t>();
+		auto size = get<std::uint32_t>();
+		if (offset > text.size() || size > text.size() - offset)
+			ok = false;
+		return ok ? text.substr(offset, size) : string_view();
+	}
+
+	Span get_span()
+	{
+		Span span;
+		span.line = get<std::uint32_t>();
+		span.column = get<std::uint32_t>();
+		span.length = get<std::uint32_t>();
+		if (span.line >= line_cnt)
+			ok = false;
+		span.line += first;
+		return span;
+	}
+};
+
+void ChunkParser::save_parsed(
+	const string &path, string_view text, size_t first,
+	const vector<string_view> &identifiers
+) const
+{
+	if (!diagnostics.empty() || !binary_paths.empty())
+		return;
+
+	CacheWriter out{text, first, {}};
+	out.put(PARSE_CACHE_MAGIC);
+	out.put(PARSE_CACHE_VERSION);
+	out.put<std::uint64_t>(text.size());
+	// Files are named by a hash of their text, which does not tell files
+	// apart, so the text itself is kept and compared
+	out.out += text;
+	out.put<std::uint64_t>(label_addr);
+	out.put<std::uint32_t>(align_cnt);
+
+	out.put<std::uint32_t>(identifiers.size());
+	for (auto ident : identifiers)
+		out.put_view(ident);
+	// Defines of the file itself, none of the earlier ones renames its names
+	vector<std::pair<string_view, string_view>> defines;
+	for (auto &kv : define_map) {
+		if (std::binary_search(
+				identifiers.begin(), identifiers.end(), kv.first,
+				IgnoreCaseLess()
+			))
+			defines.push_back(kv);
+	}
+	out.put<std::uint32_t>(defines.size());
+	for (auto &[alias, subst] : defines) {
+		out.put_view(alias);
+		out.put_view(subst);
+	}
+	out.put<std::uint32_t>(data.size());
+	out.out.append(data.begin(), data.end());
+
+	out.put<std::uint32_t>(statements.size());
+	for (auto &stmt : statements) {
+		out.put<std::uint32_t>(stmt.line - first);
+		out.put(stmt.kind);
+		out.put(stmt.opcode);
+		out.put(stmt.immediate);
+		out.put(stmt.imm_max);
+		out.put(stmt.vx);
+		out.put(stmt.vy);
+		out.put<std::uint32_t>(stmt.expr.size());
+		for (auto &node : stmt.expr) {
+			out.put(node.op);
+			out.put(node.value);
+			if (is_label_node(node))
+				out.put_view(node.label);
+		}
+		if (!stmt.expr.empty())
+			out.put_span(stmt.expr_span);
+		out.put(stmt.index);
+		out.put(stmt.size);
+	}
+	out.put<std::uint32_t>(labels.size());
+	for (auto &label : labels) {
+		out.put_view(label.name);
+		out.put<std::uint64_t>(label.offset);
+		out.put_span(label.span);
+		out.put<std::uint32_t>(label.aligns);
+	}
+	if (!out.ok)
+		return;
+
+	// Written under another name first, so that runs reading the cache at
+	// the same time never see a part of it
+	auto tmp = path + "." + std::to_string(getpid()) + "."
+			   + std::to_string(first) + ".tmp";
+	std::ofstream file(tmp, std::ios::binary);
+	file.write(out.out.data(), out.out.size());
+	file.close();
+	if (!file || std::rename(tmp.c_str(), path.c_str()) != 0)
+		std::remove(tmp.c_str());
+}
+
+bool ChunkParser::load_parsed(
+	const string &path, string_view text, size_t first, size_t last
+)
+{
+	SourceFile cached(path.c_str());
+	if (!cached)
+		return false;
+
+	CacheReader in{cached.text(), text, first, last - first};
+	if (in.get<std::uint32_t>() != PARSE_CACHE_MAGIC
+		|| in.get<std::uint32_t>() != PARSE_CACHE_VERSION
+		|| in.get<std::uint64_t>() != text.size()
+		|| in.in.substr(0, text.size()) != text)
+		return false;
+	in.in.remove_prefix(text.size());
+	auto size = in.get<std::uint64_t>();
+	auto aligns = in.get<std::uint32_t>();
+
+	vector<string_view> identifiers(in.get_count(8));
+	for (auto &ident : identifiers)
+		ident = in.get_view();
+	if (!in.ok || renames_any(define_map, identifiers))
+		return false;
+	vector<std::pair<string_view, string_view>> defines(in.get_count(16));
+	for (auto &[alias, subst] : defines) {
+		alias = in.get_view();
+		subst = in.get_view();
+	}
+	auto data_size = in.get_count(1);
+	vector<uint8_t> new_data(in.in.begin(), in.in.begin() + data_size);
+	in.in.remove_prefix(data_size);
+
+	auto is_valid = [](const Statement &stmt, size_t data_size_) {
+		// Every operator must have its operands on the stack
+		size_t depth = 0;
+		for (auto &node : stmt.expr) {
+			if (node.op > ExprOp::SHR)
+				return false;
+			auto operands = node.op >= ExprOp::ADD ? 2 : node.op >= ExprOp::NEG;
+			if (depth < size_t(operands))
+				return false;
+			depth += 1 - operands;
+		}
+		if (!stmt.expr.empty() && depth != 1)
+			return false;
+		if (stmt.kind == StmtKind::DATA)
+			return stmt.index <= data_size_ && stmt.size <= data_size_ - stmt.index;
+		if (stmt.kind == StmtKind::ALIGN)
+			return stmt.index >= 1 && stmt.index <= C8_RAM_SIZE;
+		return stmt.kind <= StmtKind::ALIGN && stmt.kind != StmtKind::BINARY
+			   && stmt.vx < C8_REG_CNT && stmt.vy < C8_REG_CNT;
+	};
+	vector<Statement> new_statements(in.get_count(20));
+	for (auto &stmt : new_statements) {
+		stmt.line = in.get<std::uint32_t>();
+		if (stmt.line >= last - first)
+			in.ok = false;
+		stmt.line += first;
+		stmt.kind = in.get<StmtKind>();
+		stmt.opcode = in.get<uint16_t>();
+		stmt.immediate = in.get<uint16_t>();
+		stmt.imm_max = in.get<uint16_t>();
+		stmt.vx = in.get<uint8_t>();
+		stmt.vy = in.get<uint8_t>();
+		for (auto n = in.get_count(9); n != 0; --n) {
+			auto op = in.get<ExprOp>();
+			ExprNode node(op, in.get<std::int64_t>());
+			if (is_label_node(node))
+				node.label = in.get_view();
+			stmt.expr.push_back(node);
+		}
+		if (!stmt.expr.empty())
+			stmt.expr_span = in.get_span();
+		stmt.index = in.get<std::uint32_t>();
+		stmt.size = in.get<std::uint32_t>();
+		if (!in.ok || !is_valid(stmt, data_size))
+			return false;
+	}
+	vector<Label> new_labels(in.get_count(32));
+	for (auto &label : new_labels) {
+		label.name = in.get_view();
+		label.offset = in.get<std::uint64_t>();
+		label.span = in.get_span();
+		label.aligns = in.get<std::uint32_t>();
+		if (label.aligns > aligns)
+			in.ok = false;
+	}
+	if (!in.ok || !in.in.empty())
+		return false;
+
+	statements = std::move(new_statements);
+	labels = std::move(new_labels);
+	data = std::move(new_data);
+	for (auto &[alias, subst] : defines)
+		define_map[alias] = subst;
+	label_addr = size;
+	align_cnt = aligns;
+	return true;
+}
+
+Parser::Parser(std::vector<string_view> asm_lines)
+	: lines(std::move(asm_lines))
+	, given_lines(lines)
+{
+}
+
+Parser::Parser(std::shared_ptr<const Preprocessed> src, bool incremental)
+	: lines(src->lines)
+	, source(std::move(src))
+	, is_incremental(incremental)
+{
+}
+
+Parser::~Parser() = default;
+
+unique_ptr<ChunkParser> Parser::new_chunk_parser()
+{
+	// Binaries may be edited while watching, so they are read instead
+	return std::make_unique<ChunkParser>(lines, source.get(), !is_incremental);
+}
+
+void Parser::split_chunks(unsigned jobs)
+{
+	auto max_chunks = std::max<size_t>(1, lines.size() / MIN_CHUNK_LINES);
+	auto chunk_cnt = std::min<size_t>(max_chunks, jobs * CHUNKS_PER_JOB);
+	if (jobs <= 1)
+		chunk_cnt = 1;
+	// Small chunks in watch mode, edits are then reparsed quickly
+	if (is_incremental)
+		chunk_cnt = std::max<size_t>(1, lines.size() / WATCH_CHUNK_LINES);
+
+	auto per_chunk = lines.size() / chunk_cnt;
+	vector<size_t> starts;
+	for (size_t i = 0; i < chunk_cnt; ++i)
+		starts.push_back(i * per_chunk);
+
+	// Each included file copied as it is gets a chunk of its own, so that
+	// its parse can be cached
+	auto caching = !cache_dir.empty() && !is_incremental && source;
+	auto run_end = [this](const VerbatimRun &run) {
+		return run.first + source->files[run.file]->text.size();
+	};
+	if (caching && !source->verbatim.empty()) {
+		auto &runs = source->verbatim;
+		auto inside = [&](size_t line) {
+			auto run = std::upper_bound(
+				runs.begin(), runs.end(), line,
+				[](size_t l, const VerbatimRun &r) { return l < r.first; }
+			);
+			return run != runs.begin() && line < run_end(*std::prev(run));
+		};
+		starts.erase(
+			std::remove_if(starts.begin(), starts.end(), inside), starts.end()
+		);
+		for (auto &run : runs) {
+			starts.push_back(run.first);
+			if (run_end(run) < lines.size())
+				starts.push_back(run_end(run));
+		}
+		std::sort(starts.begin(), starts.end());
+		starts.erase(std::unique(starts.begin(), starts.end()), starts.end());
+	}
+
+	// Find the defines visible at the start of each chunk, sequentially
+	define_scanner = std::make_unique<ChunkParser>(lines, source.get());
+	chunks.clear();
+	size_t next_run = 0;
+
+	for (size_t i = 0; i < starts.size(); ++i) {
+		Chunk chunk;
+		chunk.first = starts[i];
+		chunk.last = i + 1 == starts.size() ? lines.size() : starts[i + 1];
+		chunk.parser = new_chunk_parser();
+		chunk.parser->define_map = define_scanner->define_map;
+		chunk.source = source;
+		if (caching && next_run < source->verbatim.size()
+			&& source->verbatim[next_run].first == chunk.first)
+			chunk.file = source->verbatim[next_run++].file;
+
+		if (i + 1 != starts.size()
+			&& !define_scanner->scan_defines(chunk.first, chunk.last)) {
+			// Cannot split it up, parse everything as a single chunk
+			chunks.clear();
+			chunk.first = 0;
+			chunk.last = lines.size();
+			chunk.file = 0;
+			chunk.parser = new_chunk_parser();
+			chunks.push_back(std::move(chunk));
+			return;
+		}
+		chunks.push_back(std::move(chunk));
+	}
+}
+
+// Included files copied as they are are read from the parse cache, or
+// parsed and then cached
+void Parser::parse_chunk(Chunk &chunk)
+{
+	auto &parser = *chunk.parser;
+	if (chunk.file == 0)
+		return parser.parse_lines(chunk.first, chunk.last);
+
+	auto &file = *source->files[chunk.file];
+	auto text = file.source.text();
+	char name[32];
+	std::snprintf(
+		name, sizeof(name), "/%016llx.c8p",
+		static_cast<unsigned long long>(file.hash)
+	);
+	auto path = cache_dir + name;
+	if (parser.load_parsed(path, text, chunk.first, chunk.last))
+		return;
+
+	// Statements would differ where the defines differ, keep them uncached
+	auto identifiers = identifiers_of(text);
+	bool can_cache = !renames_any(parser.define_map, identifiers);
+	parser.parse_lines(chunk.first, chunk.last);
+	if (can_cache)
+		parser.save_parsed(path, text, chunk.first, identifiers);
+}
+
+void Parser::merge_labels()
+{
+	label_map.clear();
+	label_addrs.clear();
+	code_end = C8_PROG_START;
+	if (!chunks.empty())
+		code_end = chunks.back().base + chunks.back().parser->code_size;
+
+	for (auto &chunk : chunks) {
+		chunk.label_diagnostics.clear();
+		for (auto &label : chunk.parser->labels) {
+			size_t addr = chunk.base + chunk.parser->offset_of(label);
+			if (!label_map.insert({label.name, addr}).second) {
+				chunk.label_diagnostics.push_back(
+					{"Duplicate label name", label.span}
+				);
+			}
+			label_addrs.push_back(addr);
+		}
+	}
+
+	std::sort(label_addrs.begin(), label_addrs.end());
+
+	// Only the first statement past the end of memory is reported, all the
+	// ones after it are past it too
+	if (code_end <= C8_RAM_SIZE)
+		return;
+	auto chunk = std::find_if(chunks.begin(), chunks.end(), [](const Chunk &c) {
+		return c.base + c.parser->code_size > C8_RAM_SIZE;
+	});
+	auto addr = chunk->base;
+	for (auto &stmt : chunk->parser->statements) {
+		addr += statement_size(stmt);
+		if (addr > C8_RAM_SIZE) {
+			chunk->label_diagnostics.push_back(
+				{"Program does not fit in memory", {stmt.line, 0, 0}}
+			);
+			break;
+		}
+	}
+}
+
+static uint16_t encode_statement(const Statement &stmt)
+{
+	return stmt.opcode | stmt.immediate | (stmt.vx << C8_VX_OFFSET)
+		   | (stmt.vy << C8_VY_OFFSET);
+}
+
+void Parser::encode_chunk(Chunk &chunk)
+{
+	// Generate code even if some statemenets are invalid to report further errors
+	auto out = bincode.begin() + (chunk.base - C8_PROG_START);
+	chunk.diagnostics.clear();
+
+	auto resolve = [this](const ExprNode &node) -> optional<std::int64_t> {
+		auto found = label_map.find(node.label);
+		if (found == label_map.end())
+			return nullopt;
+		if (node.op == ExprOp::LABEL)
+			return found->second;
+
+		// Size of a label is till the next label or the end of the code
+		auto next = std::upper_bound(
+			label_addrs.begin(), label_addrs.end(), found->second
+		);
+		return (next == label_addrs.end() ? code_end : *next) - found->second;
+	};
+
+	for (auto &stmt : chunk.parser->statements) {
+		// Fix up the immediates which refer to labels
+		if (!stmt.expr.empty()) {
+			string err;
+			auto val = evaluate(stmt.expr, resolve, err);
+			auto imm = val ? fit_operand(*val, stmt.imm_max) : nullopt;
+			if (val && !imm)
+				err = "Immediate out of range";
+			if (!imm)
+				chunk.diagnostics.push_back({err, stmt.expr_span});
+			stmt.immediate = imm.value_or(0);
+		}
+
+		switch (stmt.kind) {
+		case StmtKind::INSTRUCTION: {
+			uint16_t encoded = encode_statement(stmt);
+			// 2-bytes big endian
+			*out++ = encoded >> 8;
+			*out++ = encoded & 0xFF;
+			break;
+		}
+		case StmtKind::WORD:
+			*out++ = stmt.immediate >> 8;
+			*out++ = stmt.immediate & 0xFF;
+			break;
+		case StmtKind::BYTE:
+			*out++ = stmt.immediate & 0xFF;
+			break;
+		case StmtKind::DATA:
+			std::memcpy(&*out, &chunk.parser->data[stmt.index], stmt.size);
+			out += stmt.size;
+			break;
+		case StmtKind::BINARY:
+			if (stmt.size != 0)
+				std::memcpy(
+					&*out, chunk.parser->binaries[stmt.index]->text().data(),
+					stmt.size
+				);
+			out += stmt.size;
+			break;
+		case StmtKind::FILL:
+		case StmtKind::ALIGN:
+			std::fill_n(out, stmt.size, stmt.immediate & 0xFF);
+			out += stmt.size;
+			break;
+		}
+	}
+}
+
+/// @brief Skips the next instruction(SE, SNE, SKP and SKNP)
+static bool is_skip(const Statement &stmt)
+{
+	if (stmt.kind != StmtKind::INSTRUCTION)
+		return false;
+	switch (stmt.opcode) {
+	case 0x3000:
+	case 0x4000:
+	case 0x5000:
+	case 0x9000:
+	case 0xE09E:
+	case 0xE0A1:
+		return true;
+	}
+	return false;
+}
+
+/// @brief Opcode of the skip with the opposite condition
+static uint16_t inverse_skip(uint16_t opcode)
+{
+	switch (opcode) {
+	case 0x3000:
+		return 0x4000;
+	case 0x4000:
+		return 0x3000;
+	case 0x5000:
+		return 0x9000;
+	case 0x9000:
+		return 0x5000;
+	case 0xE09E:
+		return 0xE0A1;
+	default:
+		return 0xE09E;
+	}
+}
+
+/// @brief Has no effect: LD Vx, Vx or ADD Vx, 0(does not set VF)
+static bool is_nop(const Statement &stmt)
+{
+	if (stmt.kind != StmtKind::INSTRUCTION || !stmt.expr.empty())
+		return false;
+	return (stmt.opcode == 0x8000 && stmt.vx == stmt.vy)
+		   || (stmt.opcode == 0x7000 && stmt.immediate == 0);
+}
+
+/// @brief Only sets Vx: LD Vx, byte, LD Vx, Vy or LD Vx, DT
+static bool is_pure_load(const Statement &stmt)
+{
+	return stmt.kind == StmtKind::INSTRUCTION
+		   && (stmt.opcode == 0x6000 || stmt.opcode == 0x8000
+			   || stmt.opcode == 0xF007);
+}
+
+/// @brief Sets register vx without reading it
+static bool overwrites(const Statement &stmt, uint8_t vx)
+{
+	if (stmt.kind != StmtKind::INSTRUCTION)
+		return false;
+	switch (stmt.opcode) {
+	case 0x6000: // LD Vx, byte
+	case 0xC000: // RND Vx, byte
+	case 0xF007: // LD Vx, DT
+	case 0xF00A: // LD Vx, K
+		return stmt.vx == vx;
+	case 0x8000: // LD Vx, Vy
+		return stmt.vx == vx && stmt.vy != vx;
+	case 0xF065: // LD Vx, [I], sets V0 to Vx
+		return stmt.vx >= vx;
+	}
+	return false;
+}
+
+// An instruction right after a skip is never removed, as the skip would then
+// skip the instruction after it instead.
+void Parser::optimize_chunks()
+{
+	// Statements of all the chunks in order, with their original address
+	struct Item {
+		Statement *stmt;
+		size_t addr;
+		bool removed;
+	};
+	vector<Item> items;
+	std::map<string_view, size_t, IgnoreCaseLess> label_at;
+	vector<size_t> targets;
+
+	size_t addr = C8_PROG_START;
+	for (auto &chunk : chunks) {
+		for (auto &label : chunk.parser->labels) {
+			label_at.emplace(label.name, addr + label.offset);
+			targets.push_back(addr + label.offset);
+		}
+		auto stmt_addr = addr;
+		for (auto &stmt : chunk.parser->statements) {
+			items.push_back({&stmt, stmt_addr, false});
+			stmt_addr += statement_size(stmt);
+		}
+		addr += chunk.parser->label_addr;
+	}
+	std::sort(targets.begin(), targets.end());
+	auto is_target = [&targets](size_t a) {
+		return std::binary_search(targets.begin(), targets.end(), a);
+	};
+	auto next_kept = [&items](size_t i) {
+		while (++i < items.size() && items[i].removed)
+			;
+		return i;
+	};
+	auto first_kept = [&] {
+		return items.empty() || !items[0].removed ? 0 : next_kept(0);
+	};
+	auto remove = [this, &items](size_t i) {
+		items[i].removed = true;
+		opt_stats.bytes += C8_INS_LEN;
+		opt_stats.cycles++;
+	};
+
+	// Remove no-ops
+	const Statement *prev = nullptr;
+	for (size_t i = 0; i < items.size(); ++i) {
+		if (is_nop(*items[i].stmt) && !(prev && is_skip(*prev)))
+			remove(i);
+		else
+			prev = items[i].stmt;
+	}
+
+	// Skip over a jump over the next instruction is a skip with the opposite
+	// condition: SE Vx, b; JP L; <ins>; L: -> SNE Vx, b; <ins>; L:
+	prev = nullptr;
+	for (auto i = first_kept(); i < items.size(); i = next_kept(i)) {
+		auto &skip = *items[i].stmt;
+		auto j = next_kept(i);
+		auto k = next_kept(j);
+		bool is_candidate = is_skip(skip) && !(prev && is_skip(*prev))
+							&& k < items.size();
+		prev = &skip;
+		if (!is_candidate)
+			continue;
+
+		auto &jump = *items[j].stmt;
+		if (jump.kind != StmtKind::INSTRUCTION || jump.opcode != 0x1000
+			|| is_target(items[j].addr)
+			|| items[k].stmt->kind != StmtKind::INSTRUCTION)
+			continue;
+
+		optional<size_t> target;
+		if (jump.expr.empty())
+			target = jump.immediate;
+		else if (jump.expr.size() == 1 && jump.expr[0].op == ExprOp::LABEL) {
+			auto found = label_at.find(jump.expr[0].label);
+			if (found != label_at.end())
+				target = found->second;
+		}
+		// Target must be right after the instruction, ignoring removed ones
+		auto after = k + 1;
+		while (target && after < items.size() && items[after].removed
+			   && items[after].addr < *target)
+			after++;
+		auto after_addr = after < items.size() ? items[after].addr : addr;
+		if (!target || *target != after_addr)
+			continue;
+		// Padding would move, it is not known till layout
+		if (after < items.size() && items[after].stmt->kind == StmtKind::ALIGN)
+			continue;
+
+		skip.opcode = inverse_skip(skip.opcode);
+		remove(j);
+	}
+
+	// Remove loads whose value is overwritten by the next instruction
+	prev = nullptr;
+	for (auto i = first_kept(); i < items.size(); i = next_kept(i)) {
+		auto &stmt = *items[i].stmt;
+		auto n = next_kept(i);
+		if (is_pure_load(stmt) && n < items.size()
+			&& overwrites(*items[n].stmt, stmt.vx) && !(prev && is_skip(*prev)))
+			remove(i);
+		else
+			prev = &stmt;
+	}
+	if (opt_stats.bytes == 0)
+		return;
+
+	// Drop the removed statements, labels move back by the bytes removed
+	// before them.
+	auto item = items.begin();
+	for (auto &chunk : chunks) {
+		auto &stmts = chunk.parser->statements;
+		auto label = chunk.parser->labels.begin();
+		auto labels_end = chunk.parser->labels.end();
+		size_t offset = 0;
+		size_t removed = 0;
+		vector<Statement> kept;
+		kept.reserve(stmts.size());
+
+		for (auto &stmt : stmts) {
+			for (; label != labels_end && label->offset <= offset; ++label)
+				label->offset -= removed;
+			offset += statement_size(stmt);
+			if ((item++)->removed)
+				removed += statement_size(stmt);
+			else
+				kept.push_back(std::move(stmt));
+		}
+		for (; label != labels_end; ++label)
+			label->offset -= removed;
+
+		stmts = std::move(kept);
+		chunk.parser->label_addr -= removed;
+	}
+}
+
+/// Chains longer than this are not followed, they may be jumping in a loop
+constexpr int MAX_JUMP_HOPS = 16;
+
+// Jumps and calls to a jump go to its target directly instead
+void Parser::thread_jumps()
+{
+	// Instruction at each address, null for data and the second byte
+	vector<Statement *> ins_at(bincode.size(), nullptr);
+	for (auto &chunk : chunks) {
+		auto addr = chunk.base - C8_PROG_START;
+		for (auto &stmt : chunk.parser->statements) {
+			if (stmt.kind == StmtKind::INSTRUCTION)
+				ins_at[addr] = &stmt;
+			addr += statement_size(stmt);
+		}
+	}
+
+	auto jump_at = [&ins_at](size_t target) -> const Statement * {
+		auto i = target - C8_PROG_START;
+		if (target < C8_PROG_START || i >= ins_at.size() || !ins_at[i]
+			|| ins_at[i]->opcode != 0x1000 || ins_at[i]->immediate == target)
+			return nullptr;
+		return ins_at[i];
+	};
+
+	// Follow every chain before rewriting any jump, a jump already rewritten
+	// would otherwise count as a single hop when reached from another site.
+	struct Threaded {
+		size_t at;
+		size_t target;
+		int hops;
+	};
+	vector<Threaded> threaded;
+	for (size_t i = 0; i < ins_at.size(); ++i) {
+		auto stmt = ins_at[i];
+		if (!stmt || (stmt->opcode != 0x1000 && stmt->opcode != 0x2000))
+			continue;
+
+		int hops = 0;
+		size_t target = stmt->immediate;
+		for (auto jump = jump_at(target); jump && hops < MAX_JUMP_HOPS;
+			 jump = jump_at(target), ++hops)
+			target = jump->immediate;
+		if (hops != 0)
+			threaded.push_back({i, target, hops});
+	}
+
+	for (auto &site : threaded) {
+		auto stmt = ins_at[site.at];
+		stmt->immediate = site.target;
+		auto encoded = encode_statement(*stmt);
+		bincode[site.at] = encoded >> 8;
+		bincode[site.at + 1] = encoded & 0xFF;
+		opt_stats.cycles += site.hops;
+	}
+}
+
+optional<vector<uint8_t>> Parser::parse_and_assemble(unsigned jobs)
+{
+	split_chunks(jobs);
+	opt_stats = {};
+	if (!cache_dir.empty() && !is_incremental) {
+		std::error_code err;
+		std::filesystem::create_directories(cache_dir, err);
+	}
+
+	// Phase 1: Parse chunks and find their sizes
+	parallel_for(chunks.size(), jobs, [this](size_t i) {
+		parse_chunk(chunks[i]);
+	});
+
+	auto is_parsed = [](const Chunk &chunk) {
+		return chunk.parser->diagnostics.empty();
+	};
+	bool can_optimize =
+		is_optimizing && std::all_of(chunks.begin(), chunks.end(), is_parsed);
+	// Sequential, whether the code can be changed depends on its neighbours
+	// which may be in other chunks.
+	if (can_optimize)
+		optimize_chunks();
+
+	// Chunk addresses are the prefix sum of the chunk sizes
+	size_t addr = C8_PROG_START;
+	for (auto &chunk : chunks) {
+		chunk.base = addr;
+		addr += chunk.parser->layout(addr);
+	}
+	merge_labels();
+
+	// Phase 2: Encode chunks, each into its own place in the output
+	bincode.assign(addr - C8_PROG_START, 0);
+	parallel_for(chunks.size(), jobs, [this](size_t i) {
+		encode_chunk(chunks[i]);
+	});
+
+	auto is_encoded = [](const Chunk &chunk) {
+		return chunk.diagnostics.empty() && chunk.label_diagnostics.empty();
+	};
+	if (can_optimize && std::all_of(chunks.begin(), chunks.end(), is_encoded))
+		thread_jumps();
+
+	return finish();
+}
+
+optional<vector<uint8_t>> Parser::reassemble(std::shared_ptr<const Preprocessed> src)
+{
+	assert(is_incremental && "Parser is not incremental");
+	if (is_optimizing) {
+		// Optimizer rewrites the statements in place, so none can be reused
+		lines = src->lines;
+		source = std::move(src);
+		return parse_and_assemble();
+	}
+
+	// Old lines stay alive with the old source till it is replaced
+	auto &old_lines = source_lines();
+	auto &new_lines = src->lines;
+	auto old_cnt = old_lines.size();
+	auto new_cnt = new_lines.size();
+	std::ptrdiff_t delta = new_cnt - old_cnt;
+
+	// Lines in the common prefix and suffix are not edited
+	size_t prefix = 0;
+	size_t suffix = 0;
+	auto common = std::min(old_cnt, new_cnt);
+	while (prefix < common && old_lines[prefix] == new_lines[prefix])
+		prefix++;
+	while (suffix < common - prefix
+		   && old_lines[old_cnt - 1 - suffix]
+				  == new_lines[new_cnt - 1 - suffix])
+		suffix++;
+	if (prefix == old_cnt && old_cnt == new_cnt) {
+		// Origins may still differ, like when a line is added to an include
+		source = std::move(src);
+		return finish();
+	}
+
+	// Chunks [a, b) contain the edited lines(old numbering), the chunk
+	// containing an insertion point is considered edited too.
+	size_t a = 0;
+	while (a + 1 < chunks.size() && chunks[a].last <= prefix)
+		a++;
+	size_t b = a + 1;
+	while (b < chunks.size() && chunks[b].first < old_cnt - suffix)
+		b++;
+
+	// Defines affect every line after them, so if a define is edited(or
+	// the chunks have one) then everything after them is parsed again.
+	auto any_define = [](auto beg, auto end) {
+		return std::any_of(beg, end, mentions_define);
+	};
+	auto old_beg = old_lines.begin();
+	auto new_beg = new_lines.begin();
+	if (any_define(old_beg + chunks[a].first, old_beg + chunks[b - 1].last)
+		|| any_define(new_beg + prefix, new_beg + (new_cnt - suffix)))
+		b = chunks.size();
+
+	// Lines [first, last) are parsed again(new numbering)
+	size_t first = chunks[a].first;
+	size_t last = chunks[b - 1].last + delta;
+
+	vector<string_view> new_expanded(lines.begin(), lines.begin() + first);
+	new_expanded.insert(
+		new_expanded.end(), new_beg + first, new_beg + last
+	);
+	new_expanded.insert(
+		new_expanded.end(), lines.begin() + chunks[b - 1].last, lines.end()
+	);
+	// Chunk parsers refer to this very vector, so assign it in-place
+	lines.assign(new_expanded.begin(), new_expanded.end());
+	source = std::move(src);
+
+	vector<Chunk> reparsed;
+	for (size_t beg = first; beg < last || reparsed.empty();) {
+		Chunk chunk;
+		chunk.first = beg;
+		chunk.last = std::min(last, beg + WATCH_CHUNK_LINES);
+		// Do not leave a tiny chunk at the end
+		if (last - chunk.last < WATCH_CHUNK_LINES / 2)
+			chunk.last = last;
+		chunk.parser = new_chunk_parser();
+		chunk.source = source;
+
+		// Defines visible at the start are those at the end of the previous
+		auto prev = reparsed.empty() ? (a ? &chunks[a - 1] : nullptr)
+									 : &reparsed.back();
+		if (prev)
+			chunk.parser->define_map = prev->parser->define_map;
+
+		chunk.parser->parse_lines(chunk.first, chunk.last);
+		beg = chunk.last;
+		reparsed.push_back(std::move(chunk));
+	}
+
+	for (size_t i = b; i < chunks.size(); ++i) {
+		chunks[i].first += delta;
+		chunks[i].last += delta;
+		chunks[i].parser->shift_lines(delta);
+		for (auto &diag : chunks[i].diagnostics)
+			diag.span.line += delta;
+	}
+	// Replace chunks [a, b) with the newly parsed ones. Keep the replaced
+	// ones around until the end, old label names still refer to them.
+	auto inserted = reparsed.size();
+	vector<Chunk> replaced(
+		std::make_move_iterator(chunks.begin() + a),
+		std::make_move_iterator(chunks.begin() + b)
+	);
+	chunks.erase(chunks.begin() + a, chunks.begin() + b);
+	chunks.insert(
+		chunks.begin() + a, std::make_move_iterator(reparsed.begin()),
+		std::make_move_iterator(reparsed.end())
+	);
+
+	// Find the chunks which moved and addresses of labels which changed
+	vector<bool> needs_encoding(chunks.size());
+	size_t addr = C8_PROG_START;
+	for (size_t i = 0; i < chunks.size(); ++i) {
+		auto &chunk = chunks[i];
+		needs_encoding[i] = chunk.base != addr || (a <= i && i < a + inserted);
+		chunk.base = addr;
+		addr += chunk.parser->layout(addr);
+	}
+
+	auto old_label_map = std::move(label_map);
+	merge_labels();
+	std::set<string_view, IgnoreCaseLess> changed_labels;
+	for (auto &[name, old_addr] : old_label_map) {
+		auto found = label_map.find(name);
+		if (found == label_map.end() || found->second != old_addr)
+			changed_labels.insert(name);
+	}
+	for (auto &kv : label_map) {
+		if (old_label_map.find(kv.first) == old_label_map.end())
+			changed_labels.insert(kv.first);
+	}
+
+	// Size of a label depends on the address of the label after it, so
+	// any label which changed can change the size of any other label.
+	auto refers_changed = [&changed_labels](const Statement &stmt) {
+		return std::any_of(
+			stmt.expr.begin(), stmt.expr.end(),
+			[&changed_labels](const ExprNode &node) {
+				return node.op == ExprOp::SIZEOF
+					   || (node.op == ExprOp::LABEL
+						   && changed_labels.count(node.label));
+			}
+		);
+	};
+	bincode.resize(addr - C8_PROG_START);
+	for (size_t i = 0; i < chunks.size(); ++i) {
+		auto &stmts = chunks[i].parser->statements;
+		if (!needs_encoding[i] && !changed_labels.empty())
+			needs_encoding[i] =
+				std::any_of(stmts.begin(), stmts.end(), refers_changed);
+		if (needs_encoding[i])
+			encode_chunk(chunks[i]);
+	}
+
+	return finish();
+}
+
+optional<vector<uint8_t>> Parser::finish()
+{
+	error_cnt = 0;
+	if (source)
+		report(source->diagnostics);
+	for (auto &chunk : chunks)
+		report(chunk);
+	for (auto &chunk : chunks)
+		report(chunk.diagnostics);
+
+	if (error_cnt != 0)
+		return nullopt; // Discard all code if errors
+	return bincode;
+}
+
+void Parser::write_listing(std::ostream &os) const
+{
+	constexpr char HEX[] = "0123456789ABCDEF";
+	string out;
+	auto put_hex = [&out, &HEX](unsigned val, int digits) {
+		while (digits--)
+			out += HEX[(val >> (4 * digits)) & 0xF];
+	};
+
+	for (auto &chunk : chunks) {
+		auto &stmts = chunk.parser->statements;
+		auto &labels = chunk.parser->labels;
+		auto stmt = stmts.begin();
+		auto label = labels.begin();
+		size_t addr = chunk.base;
+
+		for (auto line = chunk.first; line != chunk.last; ++line) {
+			bool has_label = false;
+			for (; label != labels.end() && label->span.line == line; ++label)
+				has_label = true;
+			bool has_code = stmt != stmts.end() && stmt->line == line;
+
+			if (has_label || has_code)
+				put_hex(addr, 4);
+			out += '\t';
+			// Data directives can have several statements on a line
+			for (; stmt != stmts.end() && stmt->line == line; ++stmt) {
+				auto size = statement_size(*stmt);
+				for (size_t i = 0; i < size; ++i)
+					put_hex(bincode[addr - C8_PROG_START + i], 2);
+				addr += size;
+			}
+			out += '\t';
+			out += source_lines()[line];
+			out += '\n';
+		}
+	}
+
+	os << out;
+}
+
+vector<string> Parser::binary_paths() const
+{
+	vector<string> ret;
+	for (auto &chunk : chunks) {
+		auto &paths = chunk.parser->binary_paths;
+		ret.insert(ret.end(), paths.begin(), paths.end());
+	}
+	return ret;
+}
+
+void Parser::write_symbols(std::ostream &os) const
+{
+	vector<std::pair<size_t, string_view>> symbols;
+	for (auto &kv : label_map)
+		symbols.emplace_back(kv.second, kv.first);
+	std::sort(symbols.begin(), symbols.end());
+
+	char addr[24];
+	for (auto &[val, name] : symbols) {
+		std::snprintf(addr, sizeof(addr), "%04zX ", val);
+		os << addr << name << '\n';
+	}
+}
+
+vector<Diagnostic> Parser::diagnostics() const
+{
+	vector<Diagnostic> ret;
+	auto append = [&ret](const vector<Diagnostic> &diags) {
+		ret.insert(ret.end(), diags.begin(), diags.end());
+	};
+	if (source)
+		append(source->diagnostics);
+	for (auto &chunk : chunks) {
+		append(chunk.parser->diagnostics);
+		append(chunk.label_diagnostics);
+		append(chunk.diagnostics);
+	}
+
+	std::stable_sort(ret.begin(), ret.end(), [](auto &a, auto &b) {
+		return a.span.line < b.span.line;
+	});
+	return ret;
+}
+
+optional<LineCode> Parser::code_of(size_t line) const
+{
+	// Last chunk which starts at or before the line
+	auto chunk = std::upper_bound(
+		chunks.begin(), chunks.end(), line,
+		[](size_t l, const Chunk &c) { return l < c.first; }
+	);
+	if (chunk == chunks.begin() || line >= (--chunk)->last)
+		return nullopt;
+
+	optional<LineCode> ret;
+	size_t addr = chunk->base;
+	for (auto &stmt : chunk->parser->statements) {
+		auto size = statement_size(stmt);
+		if (stmt.line == line) {
+			if (!ret)
+				ret = LineCode{addr, {}};
+			auto beg = bincode.begin() + (addr - C8_PROG_START);
+			if (addr - C8_PROG_START + size <= bincode.size())
+				ret->bytes.insert(ret->bytes.end(), beg, beg + size);
+		} else if (stmt.line > line) {
+			break;
+		}
+		addr += size;
+	}
+	return ret;
+}
+
+vector<string_view> Parser::labels_with_prefix(string_view prefix) const
+{
+	// Names with the prefix are next to each other in the ordering
+	vector<string_view> ret;
+	for (auto it = label_map.lower_bound(prefix); it != label_map.end(); ++it) {
+		if (it->first.size() < prefix.size()
+			|| !iequals(it->first.substr(0, prefix.size()), prefix))
+			break;
+		ret.push_back(it->first);
+	}
+	return ret;
+}
+
+optional<LabelInfo> Parser::find_label(string_view name) const
+{
+	auto found = label_map.find(name);
+	if (found == label_map.end())
+		return nullopt;
+
+	for (auto &chunk : chunks) {
+		for (auto &label : chunk.parser->labels) {
+			if (iequals(label.name, name)
+				&& chunk.base + chunk.parser->offset_of(label) == found->second)
+				return LabelInfo{found->second, label.span};
+		}
+	}
+	return nullopt;
+}
+
+void ChunkParser::log_err(string_view err_msg, Span span)
+{
+	diagnostics.push_back({string(err_msg), span});
+	error_cnt++;
+}
+
+void Parser::report(const Chunk &chunk)
+{
+	// Errors found while parsing and merging labels are reported together
+	auto diagnostics = chunk.parser->diagnostics;
+	diagnostics.insert(
+		diagnostics.end(), chunk.label_diagnostics.begin(),
+		chunk.label_diagnostics.end()
+	);
+	report(diagnostics);
+}
+
+void Parser::report(const std::vector<Diagnostic> &diagnostics)
+{
+	// Errors are reported in the order of their lines
+	vector<const Diagnostic *> sorted;
+	for (auto &diag : diagnostics)
+		sorted.push_back(&diag);
+	std::stable_sort(sorted.begin(), sorted.end(), [](auto a, auto b) {
+		return a->span.line < b->span.line;
+	});
+
+	if (!is_reporting) {
+		error_cnt += sorted.size();
+		return;
+	}
+	for (auto diag : sorted) {
+		auto span = diag->span;
+		// Print the message, lines from included files are prefixed by path
+		clog << "Parse ERROR: ";
+		if (source) {
+			auto origin = source->origin_of(span.line);
+			if (origin.file != 0)
+				clog << source->paths[origin.file] << ":";
+			clog << (origin.line + 1);
+		} else {
+			clog << (span.line + 1);
+		}
+		clog << ":" << (span.column + 1) << " " << diag->msg << "\n";
+		// Print line and mark the region of invalid token, tabs are printed as
+		// blanks so that the marker below stays aligned with the line.
+		for (auto c : lines[span.line])
+			clog << (c == '\t' ? ' ' : c);
+		clog << "\n";
+		clog << string(span.column, '~') << string(span.length, '^');
+		clog << "\n\n";
+
+		error_cnt++;
+	}
+}
@@ -0,0 +1,162 @@
+#ifndef ASSEMBLER_PARSER_HXX_INCLUDED
+#define ASSEMBLER_PARSER_HXX_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "chip8.hxx"
+#include "diagnostic.hxx"
+#include "preprocessor.hxx"
+#include "scanner.hxx"
+
+// Defined in parser.cxx
+class ChunkParser;
+
+/// @brief Savings of the optimizer, a cycle is an instruction which is not
+/// executed anymore, counted once for each place in the code.
+struct OptimizeStats {
+	std::size_t bytes = 0;
+	std::size_t cycles = 0;
+};
+
+/// @brief Code generated for a line of the source
+struct LineCode {
+	std::size_t addr = 0;
+	std::vector<std::uint8_t> bytes;
+};
+
+/// @brief Label definition, line of the span is a line of the source
+struct LabelInfo {
+	std::size_t addr = 0;
+	Span span;
+};
+
+// -----------------------------------------------------------------------
+// Chip-8 Assembly parser, assembles in two phases:
+// 1. Split the source into chunks, parse each and find its size.
+//    The chunk addresses are then found by a prefix sum of their sizes.
+// 2. Resolve labels and encode each chunk into its place in the output.
+// Chunks are processed in parallel if more than one job is given.
+class Parser
+{
+public:
+	/// Lines are views into the source buffer, which must outlive the parser
+	Parser(std::vector<std::string_view> asm_lines);
+	/// Parser which owns its preprocessed source, errors are reported at
+	/// the origin of their lines.
+	/// @param incremental Parse in small chunks, as needed for reassemble()
+	Parser(std::shared_ptr<const Preprocessed> src, bool incremental = false);
+	~Parser();
+
+	/// @param jobs Number of threads to use, 1 does everything sequentially
+	std::optional<std::vector<std::uint8_t>>
+	parse_and_assemble(unsigned jobs = 1);
+	/// Enable the peephole optimizer, it assumes that the code refers to
+	/// instruction addresses only through labels.
+	void set_optimize(bool enable) { is_optimizing = enable; }
+	/// Print the errors to clog once assembled, enabled by default
+	void set_reporting(bool enable) { is_reporting = enable; }
+	/// Keep the statements of included files copied as they are(see
+	/// VerbatimRun) in dir, keyed by the hash of their contents, so that
+	/// later runs read them instead of parsing the files again. A file is
+	/// not cached if it has errors or incbin, or if a define visible at the
+	/// include renames one of its identifiers. Not used when incremental.
+	void set_cache_dir(std::string dir) { cache_dir = std::move(dir); }
+	/// Savings of the optimizer in the last assembly
+	OptimizeStats optimize_stats() const { return opt_stats; }
+	/// Assemble the changed source incrementally. Only the chunks with
+	/// edited lines are parsed again, and only the chunks which moved or
+	/// refer to labels whose address changed are encoded again.
+	/// Parser must have been constructed as incremental and assembled before.
+	std::optional<std::vector<std::uint8_t>>
+	reassemble(std::shared_ptr<const Preprocessed> src);
+	/// Files of the incbin directives in the last assembly. They are read
+	/// once parsed, reassemble() does not notice if only they change.
+	std::vector<std::string> binary_paths() const;
+
+	/// Listing of the last successful assembly, a line for each source line:
+	/// <address>\t<bytes>\t<source line>
+	/// Address and bytes are in hex, both are empty for lines without code,
+	/// and bytes are empty for lines with only a label.
+	void write_listing(std::ostream &os) const;
+	/// Symbol map, a line for each label ordered by address: <address> <label>
+	void write_symbols(std::ostream &os) const;
+
+	/// Errors of the last assembly ordered by line, lines are of the source
+	/// given to the parser(before includes and macros are mapped back).
+	std::vector<Diagnostic> diagnostics() const;
+	/// Code of a line in the last assembly, also when it had errors
+	std::optional<LineCode> code_of(std::size_t line) const;
+	/// First definition of the label in the last assembly
+	std::optional<LabelInfo> find_label(std::string_view name) const;
+	/// Labels of the last assembly whose names start with prefix, in any case
+	std::vector<std::string_view> labels_with_prefix(std::string_view prefix) const;
+
+private:
+	struct Chunk {
+		std::size_t first = 0;
+		std::size_t last = 0;
+		// Address of the first byte of the chunk
+		std::size_t base = C8_PROG_START;
+		std::unique_ptr<ChunkParser> parser;
+		// File whose lines are the chunk if its parse is cached, else 0
+		unsigned file = 0;
+		// Keeps the source which the chunk refers to alive(in watch mode)
+		std::shared_ptr<const Preprocessed> source;
+		// Errors found while merging labels
+		std::vector<Diagnostic> label_diagnostics;
+		// Errors found while encoding
+		std::vector<Diagnostic> diagnostics;
+	};
+
+	std::unique_ptr<ChunkParser> new_chunk_parser();
+	void split_chunks(unsigned jobs);
+	void parse_chunk(Chunk &chunk);
+	void merge_labels();
+	void encode_chunk(Chunk &chunk);
+	void optimize_chunks();
+	void thread_jumps();
+	void report(const std::vector<Diagnostic> &diagnostics);
+	void report(const Chunk &chunk);
+	std::optional<std::vector<std::uint8_t>> finish();
+	/// Source lines without expansions, for listing and finding edits
+	const std::vector<std::string_view> &source_lines() const
+	{
+		return source ? source->lines : given_lines;
+	}
+
+	// Source split up into lines, a line is replaced by its expansion
+	// once define replacements have been performed on it.
+	std::vector<std::string_view> lines;
+	// Lines given to the parser without a preprocessed source
+	std::vector<std::string_view> given_lines;
+	std::shared_ptr<const Preprocessed> source;
+	bool is_incremental = false;
+	std::vector<Chunk> chunks;
+	// Finds the defines visible at the start of each chunk, must
+	// outlive the chunks as their define maps refer to its expansions.
+	std::unique_ptr<ChunkParser> define_scanner;
+	// Label and their associated addresses, past the memory if the program
+	// does not fit in it
+	std::map<std::string_view, std::size_t, IgnoreCaseLess> label_map;
+	// Sorted label addresses, for finding the size of labels
+	std::vector<std::size_t> label_addrs;
+	// Address after the last byte of code
+	std::size_t code_end = C8_PROG_START;
+	std::vector<std::uint8_t> bincode;
+
+	bool is_optimizing = false;
+	bool is_reporting = true;
+	std::string cache_dir;
+	OptimizeStats opt_stats;
+	int error_cnt = 0;
+};
+
+#endif // END parser.hxx
@@ -0,0 +1,601 @@
+#include <cctype>
+#include <algorithm>
+#include <filesystem>
+#include <iterator>
+
+#include "chip8.hxx"
+#include "preprocessor.hxx"
+#include "source.hxx"
+
+using std::string;
+using std::string_view;
+using std::vector;
+
+/// Includes and macro expansions nested deeper than this are an error, it
+/// stops recursive macros. Recursive includes are found by their paths, this
+/// also stops them if a path differs, like through a symbolic link.
+constexpr int MAX_DEPTH = 64;
+
+static inline bool is_blank(char c) { return c == ' ' || c == '\t'; }
+
+static inline bool is_ident_char(char c)
+{
+	return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+static bool is_identifier(string_view s)
+{
+	return !s.empty() && !std::isdigit(static_cast<unsigned char>(s[0]))
+		   && std::all_of(s.begin(), s.end(), is_ident_char);
+}
+
+static string_view trim(string_view s)
+{
+	while (!s.empty() && is_blank(s.front()))
+		s.remove_prefix(1);
+	while (!s.empty() && is_blank(s.back()))
+		s.remove_suffix(1);
+	return s;
+}
+
+static bool is_reserved_name(string_view s)
+{
+	auto is_s = [s](string_view name) { return iequals(s, name); };
+	return std::any_of(begin(INSTRUCTIONS), end(INSTRUCTIONS), is_s)
+		   || std::any_of(begin(REGISTERS), end(REGISTERS), is_s)
+		   || std::any_of(begin(DIRECTIVES), end(DIRECTIVES), is_s);
+}
+
+/// @brief Split at the commas which are not inside parentheses
+static vector<string_view> split_list(string_view s)
+{
+	vector<string_view> ret;
+	if (s.empty())
+		return ret;
+
+	int depth = 0;
+	size_t beg = 0;
+	for (size_t i = 0; i <= s.size(); ++i) {
+		if (i == s.size() || (s[i] == ',' && depth == 0)) {
+			ret.push_back(trim(s.substr(beg, i - beg)));
+			beg = i + 1;
+		} else if (s[i] == '(') {
+			depth++;
+		} else if (s[i] == ')') {
+			depth--;
+		}
+	}
+	return ret;
+}
+
+/// @brief Path without . and .. parts, for telling if two paths are the same
+static string normal_path(const string &path)
+{
+	return std::filesystem::path(path).lexically_normal().string();
+}
+
+// FNV-1a
+static std::uint64_t hash_text(string_view s)
+{
+	std::uint64_t hash = 0xcbf29ce484222325;
+	for (auto c : s) {
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 0x100000001b3;
+	}
+	return hash;
+}
+
+/// @brief Whether the text may have an include, macro or endm directive.
+/// The words are looked for anywhere, so a comment or a label with them
+/// counts too, this only has to be fast and never miss a directive.
+static bool may_have_directives(string_view text)
+{
+	for (size_t i = 0; i < text.size(); ++i) {
+		switch (text[i] | 0x20) {
+		case 'i':
+			if (iequals(text.substr(i, 7), "INCLUDE"))
+				return true;
+			break;
+		case 'm':
+			if (iequals(text.substr(i, 5), "MACRO"))
+				return true;
+			break;
+		case 'e':
+			if (iequals(text.substr(i, 4), "ENDM"))
+				return true;
+			break;
+		}
+	}
+	return false;
+}
+
+ScannedLine scan_line(string_view text)
+{
+	ScannedLine ret;
+	ret.text = text;
+
+	Scanner scn(text);
+	scn.skip_while(is_blank);
+	unsigned column = scn.cursor();
+	auto word = scn.skip_while(is_ident_char);
+	scn.skip_while(is_blank);
+	if (!word.empty() && scn.first() == ':') {
+		scn.skip();
+		scn.skip_while(is_blank);
+		column = scn.cursor();
+		ret.label = word;
+		word = scn.skip_while(is_ident_char);
+		scn.skip_while(is_blank);
+	}
+	if (!is_identifier(word))
+		return ret;
+
+	ret.column = column;
+	auto rest = text.substr(scn.cursor());
+	if (iequals(word, "INCLUDE")) {
+		ret.kind = LineKind::INCLUDE;
+		auto close = rest.find('"', 1);
+		if (!rest.empty() && rest[0] == '"' && close != string_view::npos)
+			ret.word = rest.substr(1, close - 1);
+		return ret;
+	}
+
+	rest = trim(rest.substr(0, rest.find(';')));
+	if (iequals(word, "MACRO")) {
+		ret.kind = LineKind::MACRO;
+		auto name_end = std::find_if_not(rest.begin(), rest.end(), is_ident_char);
+		ret.word = rest.substr(0, name_end - rest.begin());
+		ret.rest = trim(rest.substr(ret.word.size()));
+	} else if (iequals(word, "ENDM")) {
+		ret.kind = LineKind::ENDM;
+	} else {
+		ret.kind = LineKind::WORD;
+		ret.word = word;
+		ret.rest = rest;
+	}
+	return ret;
+}
+
+string Preprocessed::resolve_path(unsigned file, string_view path) const
+{
+	string ret(path);
+	auto &parent = paths[file];
+	auto slash = parent.rfind('/');
+	if (!ret.empty() && ret.front() != '/' && slash != string::npos)
+		ret.insert(0, parent, 0, slash + 1);
+	return ret;
+}
+
+LineOrigin Preprocessed::origin_of(size_t line) const
+{
+	auto run = std::upper_bound(
+		origin_runs.begin(), origin_runs.end(), line,
+		[](size_t l, const OriginRun &r) { return l < r.first; }
+	);
+	if (run == origin_runs.begin())
+		return {};
+	--run;
+	auto ret = run->origin;
+	if (!ret.is_expanded)
+		ret.line += line - run->first;
+	return ret;
+}
+
+vector<size_t> Preprocessed::lines_of_main(unsigned line) const
+{
+	// The line is in the last run starting before it, or starts a run
+	auto run = std::lower_bound(
+		origin_runs.begin(), origin_runs.end(), line,
+		[](const OriginRun &r, unsigned l) { return r.main_line < l; }
+	);
+	vector<size_t> ret;
+	if (run != origin_runs.begin()) {
+		auto prev = std::prev(run);
+		auto end = run == origin_runs.end() ? lines.size() : run->first;
+		auto &origin = prev->origin;
+		if (origin.file == 0 && !origin.is_expanded
+			&& line - origin.line < end - prev->first)
+			ret.push_back(prev->first + line - origin.line);
+	}
+	// Then come the runs of its expansion, or of the files it includes
+	for (; run != origin_runs.end() && run->main_line == line; ++run) {
+		auto &origin = run->origin;
+		if (origin.file != 0)
+			continue;
+		auto end = std::next(run) == origin_runs.end()
+			? lines.size() : std::next(run)->first;
+		if (!origin.is_expanded)
+			end = run->first + 1;
+		for (auto i = run->first; i < end; ++i)
+			ret.push_back(i);
+	}
+	return ret;
+}
+
+std::shared_ptr<const Preprocessed> Preprocessor::run(const string &path)
+{
+	run_cnt++;
+	auto file = load(path);
+	if (!file)
+		return nullptr;
+	return preprocess(path, std::move(file));
+}
+
+std::shared_ptr<const Preprocessed>
+Preprocessor::run(const string &path, std::shared_ptr<const ScannedFile> main)
+{
+	run_cnt++;
+	return preprocess(path, std::move(main));
+}
+
+std::shared_ptr<const Preprocessed>
+Preprocessor::preprocess(const string &path, std::shared_ptr<const ScannedFile> file)
+{
+	out = std::make_shared<Preprocessed>();
+	macros.clear();
+
+	out->paths.push_back(path);
+	out->files.push_back(file);
+	out->lines.reserve(file->text.size());
+	including = {normal_path(path)};
+	process_file(*file, 0, 0);
+	including.clear();
+
+	// Drop the files which are not used anymore
+	for (auto it = cache.begin(); it != cache.end();)
+		it = it->second.run != run_cnt ? cache.erase(it) : std::next(it);
+	macros.clear();
+	return std::move(out);
+}
+
+std::shared_ptr<const Preprocessed> Preprocessor::patch(
+	const Preprocessed &prev, size_t first, size_t old_last, size_t new_last
+)
+{
+	auto out = std::make_shared<Preprocessed>();
+	auto &text = prev.files[0]->text;
+	std::ptrdiff_t delta = new_last - old_last;
+	// Replaced lines are copied as they are, so they follow each other
+	auto beg = prev.lines_of_main(first).front();
+	auto end = beg + (old_last - first);
+
+	out->lines.reserve(prev.lines.size() + delta);
+	out->lines.insert(out->lines.end(), prev.lines.begin(), prev.lines.begin() + beg);
+	out->lines.insert(
+		out->lines.end(), text.begin() + first, text.begin() + new_last
+	);
+	out->lines.insert(out->lines.end(), prev.lines.begin() + end, prev.lines.end());
+
+	// Everything after the replaced lines moves, the run having them grows
+	out->origin_runs = prev.origin_runs;
+	for (auto &run : out->origin_runs) {
+		if (run.first <= beg)
+			continue;
+		run.first += delta;
+		run.main_line += delta;
+		if (run.origin.file == 0)
+			run.origin.line += delta;
+	}
+	out->diagnostics = prev.diagnostics;
+	for (auto &diag : out->diagnostics) {
+		if (diag.span.line >= end)
+			diag.span.line += delta;
+	}
+	out->verbatim = prev.verbatim;
+	for (auto &run : out->verbatim) {
+		if (run.first >= end)
+			run.first += delta;
+	}
+	out->paths = prev.paths;
+	out->files = prev.files;
+	out->expansions = prev.expansions;
+	return out;
+}
+
+std::shared_ptr<const ScannedFile> Preprocessor::load(const string &path)
+{
+	SourceFile source(path.c_str(), allow_mapping);
+	if (!source)
+		return nullptr;
+
+	// The file has to be read anyways, but not scanned again if seen before
+	auto hash = hash_text(source.text());
+	auto it = cache.find(hash);
+	if (it != cache.end() && it->second.file->source.text() == source.text()) {
+		it->second.run = run_cnt;
+		return it->second.file;
+	}
+
+	auto file = std::make_shared<ScannedFile>();
+	file->source = std::move(source);
+	file->hash = hash;
+	file->text = file->source.lines();
+	if (may_have_directives(file->source.text())) {
+		file->lines.reserve(file->text.size());
+		for (auto line : file->text)
+			file->lines.push_back(scan_line(line));
+	}
+
+	// On a hash collision the file is just not cached
+	if (it == cache.end())
+		cache[hash] = {file, run_cnt};
+	return file;
+}
+
+void Preprocessor::process_file(const ScannedFile &scanned, unsigned file, int depth)
+{
+	if (scanned.lines.size() == scanned.text.size())
+		return process(scanned.lines, file, nullptr, depth);
+
+	// Without directives the file is copied as it is, unless it may invoke
+	// macros defined before
+	if (macros.empty()) {
+		auto &text = scanned.text;
+		if (file != 0 && !text.empty())
+			out->verbatim.push_back({out->lines.size(), file});
+		emit_run(text.data(), text.data() + text.size(), {file, 0});
+		return;
+	}
+	vector<ScannedLine> lines;
+	lines.reserve(scanned.text.size());
+	for (auto line : scanned.text)
+		lines.push_back(scan_line(line));
+	process(lines, file, nullptr, depth);
+}
+
+void Preprocessor::process(
+	const vector<ScannedLine> &lines, unsigned file,
+	const LineOrigin *invocation, int depth
+)
+{
+	// Macro being defined, its body is collected till endm
+	Macro *defining = nullptr;
+	Macro discarded;
+	size_t macro_line = 0;
+
+	for (unsigned i = 0; i < lines.size(); ++i) {
+		auto &line = lines[i];
+		auto origin = invocation
+						  ? LineOrigin{invocation->file, invocation->line, true}
+						  : LineOrigin{file, i};
+		auto word_span = [&line](string_view word) {
+			return std::make_pair(
+				unsigned(word.data() - line.text.data() + 1), unsigned(word.size())
+			);
+		};
+
+		if (!line.label.empty()
+			&& (line.kind == LineKind::MACRO || line.kind == LineKind::ENDM)) {
+			emit_commented(line, origin);
+			log_err("Label is not allowed here", 0, line.column + 1);
+			if (line.kind == LineKind::ENDM)
+				defining = nullptr;
+			continue;
+		}
+
+		if (defining) {
+			emit_commented(line, origin);
+			if (line.kind == LineKind::ENDM)
+				defining = nullptr;
+			else if (line.kind == LineKind::MACRO)
+				log_err("Nested macro definition", line.column + 1, 5);
+			else
+				defining->body.push_back(line.text);
+			continue;
+		}
+
+		switch (line.kind) {
+		case LineKind::PLAIN:
+			emit(line.text, origin);
+			break;
+
+		case LineKind::INCLUDE: {
+			emit_commented(line, origin);
+			if (line.word.empty()) {
+				log_err("Expected quoted file name after include", line.column + 1, 7);
+				break;
+			}
+			auto [column, length] = word_span(line.word);
+			if (depth >= MAX_DEPTH) {
+				log_err("Includes are nested too deeply", column, length);
+				break;
+			}
+
+			// Relative to the directory of the including file
+			auto path = out->resolve_path(origin.file, line.word);
+			auto normal = normal_path(path);
+			if (std::find(including.begin(), including.end(), normal)
+				!= including.end()) {
+				log_err("Recursive include of '" + path + "'", column, length);
+				break;
+			}
+			auto included = load(path);
+			if (!included) {
+				log_err("Cannot open file '" + path + "'", column, length);
+				break;
+			}
+			out->paths.push_back(std::move(path));
+			out->files.push_back(included);
+			including.push_back(std::move(normal));
+			process_file(*included, out->paths.size() - 1, depth + 1);
+			including.pop_back();
+			break;
+		}
+
+		case LineKind::MACRO: {
+			emit_commented(line, origin);
+			macro_line = out->lines.size() - 1;
+			defining = &discarded;
+			if (!is_identifier(line.word)) {
+				log_err("Expected macro name after macro", line.column + 1, 5);
+				break;
+			}
+			auto [column, length] = word_span(line.word);
+			if (is_reserved_name(line.word)) {
+				log_err("Macro name cannot be a reserved name", column, length);
+				break;
+			}
+			auto [it, inserted] = macros.try_emplace(line.word);
+			if (!inserted) {
+				log_err("Duplicate macro: " + string(line.word), column, length);
+				break;
+			}
+
+			defining = &it->second;
+			for (auto param : split_list(line.rest)) {
+				std::tie(column, length) = word_span(param);
+				auto &params = defining->params;
+				if (!is_identifier(param) || is_reserved_name(param))
+					log_err("Invalid macro parameter", column, length);
+				else if (std::any_of(params.begin(), params.end(), [param](auto p) {
+							 return iequals(p, param);
+						 }))
+					log_err("Duplicate macro parameter", column, length);
+				params.push_back(param);
+			}
+			break;
+		}
+
+		case LineKind::ENDM:
+			emit_commented(line, origin);
+			log_err("endm without a macro", line.column + 1, 4);
+			break;
+
+		case LineKind::WORD: {
+			auto it = macros.find(line.word);
+			if (it == macros.end())
+				emit(line.text, origin);
+			else
+				expand(it->second, line, origin, depth);
+			break;
+		}
+		}
+	}
+
+	if (defining)
+		out->diagnostics.push_back(
+			{"Macro is not closed by endm", {unsigned(macro_line), 0, 0}}
+		);
+}
+
+void Preprocessor::expand(
+	const Macro &macro, const ScannedLine &line, LineOrigin origin, int depth
+)
+{
+	emit_commented(line, origin);
+	auto column = line.column + 1;
+	auto length = unsigned(line.word.size());
+	if (depth >= MAX_DEPTH)
+		return log_err("Macros are nested too deeply", column, length);
+	// Each invocation in the body would expand it again, exponentially many
+	// times below the depth limit
+	if (std::find(expanding.begin(), expanding.end(), &macro) != expanding.end())
+		return log_err(
+			"Recursive invocation of macro " + string(line.word), column, length
+		);
+
+	auto args = split_list(line.rest);
+	if (args.size() != macro.params.size())
+		return log_err(
+			"Macro " + string(line.word) + " expects "
+				+ std::to_string(macro.params.size()) + " arguments, got "
+				+ std::to_string(args.size()),
+			column, length
+		);
+	if (std::any_of(args.begin(), args.end(), [](auto a) { return a.empty(); }))
+		return log_err("Empty macro argument", column, length);
+
+	vector<ScannedLine> expanded;
+	expanded.reserve(macro.body.size());
+	for (auto body_line : macro.body)
+		expanded.push_back(scan_line(substitute(body_line, macro, args)));
+	expanding.push_back(&macro);
+	process(expanded, origin.file, &origin, depth + 1);
+	expanding.pop_back();
+}
+
+string_view Preprocessor::substitute(
+	string_view line, const Macro &macro, const vector<string_view> &args
+)
+{
+	string ret;
+	size_t copied = 0;
+	size_t pos = 0;
+	// Parameters are not replaced in the comment
+	while (pos < line.size() && line[pos] != ';') {
+		if (!is_ident_char(line[pos])) {
+			pos++;
+			continue;
+		}
+
+		auto beg = pos;
+		while (pos < line.size() && is_ident_char(line[pos]))
+			pos++;
+		auto ident = line.substr(beg, pos - beg);
+		auto param = std::find_if(
+			macro.params.begin(), macro.params.end(),
+			[ident](auto p) { return iequals(p, ident); }
+		);
+		if (param == macro.params.end())
+			continue;
+
+		ret.append(line, copied, beg - copied);
+		ret.append(args[param - macro.params.begin()]);
+		copied = pos;
+	}
+
+	// Line without parameters is used as is
+	if (copied == 0)
+		return line;
+	ret.append(line, copied);
+	out->expansions->push_back(std::move(ret));
+	return out->expansions->back();
+}
+
+void Preprocessor::emit(string_view line, LineOrigin origin)
+{
+	emit_run(&line, &line + 1, origin);
+}
+
+void Preprocessor::emit_run(
+	const string_view *beg, const string_view *end, LineOrigin origin
+)
+{
+	// Lines which follow the last run in its file, or are of the same
+	// invocation, extend it
+	auto &runs = out->origin_runs;
+	auto at = out->lines.size();
+	if (runs.empty()) {
+		runs.push_back({at, origin, origin.line});
+	} else {
+		auto &last = runs.back().origin;
+		auto next_line = last.line + (last.is_expanded ? 0 : at - runs.back().first);
+		if (origin.file != last.file || origin.is_expanded != last.is_expanded
+			|| origin.line != next_line) {
+			// Lines of other files come from the last line of the main file
+			auto main_line = runs.back().main_line;
+			if (origin.file == 0)
+				main_line = origin.line;
+			else if (last.file == 0 && !last.is_expanded)
+				main_line = static_cast<unsigned>(next_line - 1);
+			runs.push_back({at, origin, main_line});
+		}
+	}
+	out->lines.insert(out->lines.end(), beg, end);
+}
+
+void Preprocessor::emit_commented(const ScannedLine &line, LineOrigin origin)
+{
+	auto text = line.text;
+	string commented(text.substr(0, line.column));
+	commented += ';';
+	commented += text.substr(line.column);
+	out->expansions->push_back(std::move(commented));
+	emit(out->expansions->back(), origin);
+}
+
+void Preprocessor::log_err(string msg, unsigned column, unsigned length)
+{
+	Span span{unsigned(out->lines.size() - 1), column, length};
+	out->diagnostics.push_back({std::move(msg), span});
+}
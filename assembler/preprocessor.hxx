@@ -0,0 +1,195 @@
+#ifndef ASSEMBLER_PREPROCESSOR_HXX_INCLUDED
+#define ASSEMBLER_PREPROCESSOR_HXX_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "diagnostic.hxx"
+#include "scanner.hxx"
+#include "source.hxx"
+
+enum class LineKind : std::uint8_t {
+	PLAIN,
+	INCLUDE,
+	MACRO,
+	ENDM,
+	// Line with an identifier which may be a macro invocation
+	WORD,
+};
+
+/// @brief A line scanned for directives and macro invocations
+struct ScannedLine {
+	std::string_view text;
+	LineKind kind = LineKind::PLAIN;
+	// Included path, name of the defined macro or the identifier
+	std::string_view word;
+	// Macro parameters or arguments, without the comment
+	std::string_view rest;
+	// Label before the directive or identifier, if any
+	std::string_view label;
+	// Column of the directive or identifier
+	unsigned column = 0;
+};
+
+ScannedLine scan_line(std::string_view text);
+
+/// @brief Source file split into lines, the lines scanned if it has directives
+struct ScannedFile {
+	// Empty if the lines are kept elsewhere, like for an unsaved file
+	SourceFile source;
+	// Hash of the contents of source
+	std::uint64_t hash = 0;
+	std::vector<std::string_view> text;
+	// Scan of each line of text. Empty for a file without include, macro or
+	// endm, its lines are then only scanned if macros are defined.
+	std::vector<ScannedLine> lines;
+};
+
+/// @brief Where a line of the preprocessed source came from
+struct LineOrigin {
+	// Index into Preprocessed::paths
+	unsigned file = 0;
+	// Line in that file, for macro expansions the line of the invocation
+	unsigned line = 0;
+	// Line of a macro body, its columns are not those of the origin
+	bool is_expanded = false;
+};
+
+/// @brief Lines of the preprocessed source with a common origin: consecutive
+/// lines of a file, or the lines of one macro invocation.
+struct OriginRun {
+	// First line of the run in Preprocessed::lines
+	std::size_t first = 0;
+	LineOrigin origin;
+	// Line of the main file which the run starts at or is included or
+	// expanded from. Never decreases from a run to the next.
+	unsigned main_line = 0;
+};
+
+/// @brief Lines of an included file copied as they are, the file has no
+/// directives and no macros were defined before it
+struct VerbatimRun {
+	// First line of the file in Preprocessed::lines
+	std::size_t first = 0;
+	// Index into Preprocessed::files
+	unsigned file = 0;
+};
+
+/// @brief Source with includes and macros expanded into a flat list of lines.
+/// Include, macro definition and invocation lines are kept commented out, so
+/// that the listing still shows them.
+struct Preprocessed {
+	std::vector<std::string_view> lines;
+	// Origins of the lines, a run for each include or expansion
+	std::vector<OriginRun> origin_runs;
+	// Path of every included file, the first one is the main file
+	std::vector<std::string> paths;
+	// Errors in directives or macro invocations, line is an index in lines
+	std::vector<Diagnostic> diagnostics;
+	// Files and expansions which the lines refer to, a patched source
+	// shares the expansions of the one it was patched from
+	std::vector<std::shared_ptr<const ScannedFile>> files;
+	std::shared_ptr<std::deque<std::string>> expansions =
+		std::make_shared<std::deque<std::string>>();
+	// Included files copied as they are, in the order of their lines
+	std::vector<VerbatimRun> verbatim;
+
+	/// @brief Path as written in the file, made relative to its directory
+	std::string resolve_path(unsigned file, std::string_view path) const;
+	/// @brief Where a line came from
+	LineOrigin origin_of(std::size_t line) const;
+	/// @brief Lines which come from a line of the main file: the line itself
+	/// and the lines of its macro expansion, in order
+	std::vector<std::size_t> lines_of_main(unsigned line) const;
+};
+
+/// @brief Expands include directives and macros.
+/// Files read are scanned once and cached by their contents in memory, for
+/// as long as the Preprocessor lives. A file included many times in a run is
+/// scanned once, and so is a file unchanged between the runs of watch mode
+/// or the language server. Nothing is kept across processes here, the parser
+/// can cache the statements of the files copied as they are on disk, see
+/// Parser::set_cache_dir().
+class Preprocessor
+{
+public:
+	/// @param allow_mapping Passed on to SourceFile, see there
+	explicit Preprocessor(bool allow_mapping_ = true)
+		: allow_mapping(allow_mapping_)
+	{
+	}
+
+	/// @return nullptr if the main file cannot be read
+	std::shared_ptr<const Preprocessed> run(const std::string &path);
+	/// Main file is given already scanned, it is not read from path
+	std::shared_ptr<const Preprocessed>
+	run(const std::string &path, std::shared_ptr<const ScannedFile> main);
+	/// Source of prev after lines [first, old_last) of its main file were
+	/// replaced by lines [first, new_last) of it, which is edited in place.
+	/// Nothing is preprocessed again, so both the replaced and the new lines
+	/// must be copied as they are: no directive, macro invocation or line of
+	/// a macro definition.
+	static std::shared_ptr<const Preprocessed> patch(
+		const Preprocessed &prev, std::size_t first, std::size_t old_last,
+		std::size_t new_last
+	);
+
+private:
+	struct Macro {
+		std::vector<std::string_view> params;
+		std::vector<std::string_view> body;
+	};
+
+	struct CacheEntry {
+		std::shared_ptr<const ScannedFile> file;
+		// Last run which used the file, unused files are dropped after a run
+		unsigned run = 0;
+	};
+
+	std::shared_ptr<const ScannedFile> load(const std::string &path);
+	std::shared_ptr<const Preprocessed>
+	preprocess(const std::string &path, std::shared_ptr<const ScannedFile> file);
+	void process_file(const ScannedFile &scanned, unsigned file, int depth);
+	void process(
+		const std::vector<ScannedLine> &lines, unsigned file,
+		const LineOrigin *invocation, int depth
+	);
+	void expand(
+		const Macro &macro, const ScannedLine &line, LineOrigin origin, int depth
+	);
+	// Replace the parameters in a line of the macro body by the arguments
+	std::string_view substitute(
+		std::string_view line, const Macro &macro,
+		const std::vector<std::string_view> &args
+	);
+	void emit(std::string_view line, LineOrigin origin);
+	// Lines with consecutive origins from origin on
+	void emit_run(
+		const std::string_view *beg, const std::string_view *end,
+		LineOrigin origin
+	);
+	void emit_commented(const ScannedLine &line, LineOrigin origin);
+	void log_err(std::string msg, unsigned column, unsigned length);
+
+	bool allow_mapping = true;
+	unsigned run_cnt = 0;
+	// Scanned files keyed by the hash of their contents
+	std::unordered_map<std::uint64_t, CacheEntry> cache;
+
+	// State of the current run
+	std::shared_ptr<Preprocessed> out;
+	std::map<std::string_view, Macro, IgnoreCaseLess> macros;
+	// Normalized paths of the files being included, outermost first
+	std::vector<std::string> including;
+	// Macros being expanded, outermost first
+	std::vector<const Macro *> expanding;
+};
+
+#endif // END preprocessor.hxx
@@ -2,8 +2,38 @@
 #define ASSEMBLER_SCANNER_HXX_INCLUDED
 
 #include <cassert>
+#include <algorithm>
+#include <cctype>
 #include <string_view>
-#include <functional>
+
+/// @brief Case-insensitive equality, source text is never uppercased
+inline bool iequals(std::string_view a, std::string_view b)
+{
+	if (a.size() != b.size())
+		return false;
+	for (std::string_view::size_type i = 0; i < a.size(); ++i) {
+		// Bytes of UTF-8 are negative chars, which toupper() does not take
+		if (std::toupper(static_cast<unsigned char>(a[i]))
+			!= std::toupper(static_cast<unsigned char>(b[i])))
+			return false;
+	}
+	return true;
+}
+
+/// @brief Case-insensitive ordering, for maps keyed by source identifiers
+struct IgnoreCaseLess {
+	bool operator()(std::string_view a, std::string_view b) const
+	{
+		auto n = std::min(a.size(), b.size());
+		for (std::string_view::size_type i = 0; i < n; ++i) {
+			int ca = std::toupper(static_cast<unsigned char>(a[i]));
+			int cb = std::toupper(static_cast<unsigned char>(b[i]));
+			if (ca != cb)
+				return ca < cb;
+		}
+		return a.size() < b.size();
+	}
+};
 
 class Scanner
 {
@@ -47,17 +77,18 @@ public:
 		}
 	}
 
-	std::string_view skip_while(std::function<bool(char)> unary_pred)
+	template <typename Pred>
+	std::string_view skip_while(Pred unary_pred)
 	{
-		auto ret = remaining;
-		int cnt = 0;
-		while (auto c = first()) {
-			if (!unary_pred(c))
-				break;
+		std::string_view::size_type cnt = 0;
+		while (cnt < remaining.size() && remaining[cnt] != EOF_CHAR
+			   && unary_pred(remaining[cnt]))
 			cnt++;
-			skip();
-		}
-		return ret.substr(0, cnt);
+
+		auto ret = remaining.substr(0, cnt);
+		if (cnt != 0)
+			skip(cnt);
+		return ret;
 	}
 
 private:
@@ -0,0 +1,97 @@
+#include <cstring>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "source.hxx"
+
+using std::string_view;
+using std::vector;
+
+SourceFile::SourceFile(const char *path, bool allow_mapping)
+{
+	int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return;
+
+	struct stat st {};
+	if (allow_mapping && fstat(fd, &st) == 0 && S_ISREG(st.st_mode)
+		&& st.st_size > 0) {
+		void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (addr != MAP_FAILED) {
+			// Source is scanned front to back exactly once
+			madvise(addr, st.st_size, MADV_SEQUENTIAL);
+			data = static_cast<const char *>(addr);
+			size = st.st_size;
+			is_mapped = true;
+			ok = true;
+			close(fd);
+			return;
+		}
+	}
+
+	// Cannot map it, read everything into the buffer instead
+	char chunk[1 << 16];
+	ssize_t n = 0;
+	while ((n = read(fd, chunk, sizeof(chunk))) > 0)
+		buffer.append(chunk, n);
+	close(fd);
+
+	ok = n == 0;
+	data = buffer.data();
+	size = buffer.size();
+}
+
+SourceFile::SourceFile(SourceFile &&other) noexcept { *this = std::move(other); }
+
+SourceFile &SourceFile::operator=(SourceFile &&other) noexcept
+{
+	if (this == &other)
+		return *this;
+
+	release();
+	is_mapped = std::exchange(other.is_mapped, false);
+	ok = std::exchange(other.ok, false);
+	size = std::exchange(other.size, 0);
+	data = std::exchange(other.data, nullptr);
+	buffer = std::move(other.buffer);
+	// Buffer may have moved(or be stored inline), so point to it again
+	if (!is_mapped)
+		data = buffer.data();
+
+	return *this;
+}
+
+vector<string_view> SourceFile::lines() const
+{
+	vector<string_view> ret;
+	const char *beg = data;
+	const char *end = data + size;
+
+	while (beg < end) {
+		auto nl = static_cast<const char *>(std::memchr(beg, '\n', end - beg));
+		auto line_end = nl ? nl : end;
+		auto len = line_end - beg;
+		if (len > 0 && beg[len - 1] == '\r')
+			len--;
+
+		ret.emplace_back(beg, len);
+		beg = line_end + 1;
+	}
+
+	return ret;
+}
+
+void SourceFile::release()
+{
+	if (is_mapped)
+		munmap(const_cast<char *>(data), size);
+	is_mapped = false;
+	data = nullptr;
+	size = 0;
+}
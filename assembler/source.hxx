@@ -0,0 +1,41 @@
+#ifndef ASSEMBLER_SOURCE_HXX_INCLUDED
+#define ASSEMBLER_SOURCE_HXX_INCLUDED
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @brief Read-only contents of a source file, kept as a single buffer.
+/// The file is mapped into memory if possible, otherwise it is read in one
+/// go into an owned buffer(pipes, special files, etc.).
+class SourceFile
+{
+public:
+	SourceFile() = default;
+	/// @param allow_mapping Must be false if the file can be changed while
+	/// its contents are in use, truncating a mapped file makes reads fault.
+	explicit SourceFile(const char *path, bool allow_mapping = true);
+	SourceFile(SourceFile &&other) noexcept;
+	SourceFile &operator=(SourceFile &&other) noexcept;
+	SourceFile(const SourceFile &) = delete;
+	SourceFile &operator=(const SourceFile &) = delete;
+	~SourceFile() { release(); }
+
+	explicit operator bool() const { return ok; }
+	std::string_view text() const { return {data, size}; }
+	/// Split the text into lines, line terminators(LF or CRLF) are excluded
+	std::vector<std::string_view> lines() const;
+
+private:
+	void release();
+
+	const char *data = nullptr;
+	std::size_t size = 0;
+	bool is_mapped = false;
+	bool ok = false;
+	// Only used if the file could not be mapped
+	std::string buffer;
+};
+
+#endif // END source.hxx
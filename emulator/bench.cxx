@@ -0,0 +1,372 @@
+// Emulator core benchmark on fixed-seed workloads.
+// Times Emulator::step() on loops of each class of instructions, DRW by
+// sprite height and x alignment, DecodedIns construction and to_string(),
+// and whole runs of the bundled programs, which are assembled at start.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "chip8.hxx"
+#include "decoder.hxx"
+#include "emulator.hxx"
+#include "parser.hxx"
+
+using std::clog;
+using std::size_t;
+using std::string;
+using std::string_view;
+using std::uint16_t;
+using std::uint64_t;
+using std::vector;
+using I = Instruction;
+
+/// Copies of the instruction in the loop of a step workload
+constexpr unsigned LOOP_INS_CNT = 1024;
+/// Scratch RAM for the memory instructions, past any program
+constexpr uint16_t SCRATCH_ADDR = 0xE00;
+/// Ops timed at a time are doubled till a batch takes this long
+constexpr double MIN_BATCH_SECONDS = 0.01;
+
+// Programs run whole, the instructions per second of real ROMs
+constexpr string_view PROGRAMS[][2] = {
+	{"count", R"(
+	ld v5, 0
+loop:
+	add v5, 1
+	ld I, digits
+	ld B, v5
+	ld v2, [I]
+	cls
+	ld v3, 0
+	ld v4, 0
+	ld F, v0
+	drw v3, v4, 5
+	add v3, 5
+	ld F, v1
+	drw v3, v4, 5
+	add v3, 5
+	ld F, v2
+	drw v3, v4, 5
+	jp loop
+digits:
+	db 0, 0, 0
+)"},
+	{"bounce", R"(
+	ld v0, 0 ; Position
+	ld v1, 0
+	ld v2, 1 ; Direction
+	ld v3, 1
+	ld I, ball
+loop:
+	drw v0, v1, 4
+	drw v0, v1, 4
+	add v0, v2
+	add v1, v3
+	se v0, 60
+	jp left
+	ld v2, 255
+left:
+	sne v0, 0
+	ld v2, 1
+	se v1, 28
+	jp top
+	ld v3, 255
+top:
+	sne v1, 0
+	ld v3, 1
+	jp loop
+ball:
+	db 0x60, 0xF0, 0xF0, 0x60
+)"},
+	{"calls", R"(
+loop:
+	call first
+	call second
+	jp loop
+first:
+	add v0, 1
+	call common
+	ret
+second:
+	rnd v1, 0xFF
+	call common
+	ret
+common:
+	ld I, buffer
+	ld [I], v3
+	ld v3, [I]
+	xor v2, v1
+	ret
+buffer:
+	db 0, 0, 0, 0
+)"},
+};
+
+static uint16_t encode(I type, unsigned x = 0, unsigned y = 0, unsigned imm = 0)
+{
+	return OPCODES[static_cast<int>(type)] | x << C8_VX_OFFSET
+		   | y << C8_VY_OFFSET | imm;
+}
+
+/// @brief ROM of: the setup instructions, then a loop of the body
+static vector<uint8_t> make_rom(
+	const vector<uint16_t> &setup, const std::function<uint16_t(unsigned)> &body
+)
+{
+	vector<uint16_t> words = setup;
+	auto loop_addr = C8_PROG_START + C8_INS_LEN * words.size();
+	for (unsigned i = 0; i < LOOP_INS_CNT; ++i)
+		words.push_back(body(i));
+	words.push_back(encode(I::JP_a, 0, 0, loop_addr));
+	// Called by the CALL loop
+	words.push_back(encode(I::RET));
+
+	vector<uint8_t> ret;
+	for (auto w : words) {
+		ret.push_back(w >> 8);
+		ret.push_back(w & 0xFF);
+	}
+	return ret;
+}
+
+/// @brief A workload: run does the given number of ops, unit is an op
+struct Workload {
+	string name;
+	const char *unit;
+	std::function<void(uint64_t)> run;
+};
+
+static Workload step_workload(string name, vector<uint8_t> rom)
+{
+	return {std::move(name), "step", [rom](uint64_t steps) {
+				Emulator emu(rom.data(), rom.data() + rom.size());
+				emu.seed(1);
+				emu.set_step_time(1.0 / 300);
+				for (uint64_t i = 0; i < steps; ++i)
+					emu.step();
+			}};
+}
+
+static vector<Workload> step_workloads()
+{
+	std::mt19937 rng(1);
+	auto reg = [&rng]() { return unsigned(rng() % 15); }; // Not VF
+	auto byte = [&rng]() { return unsigned(rng() % 256); };
+	auto pick = [&rng](std::initializer_list<I> types) {
+		return *(types.begin() + rng() % types.size());
+	};
+	auto next_addr = [](unsigned i) { return C8_PROG_START + C8_INS_LEN * (i + 1); };
+	auto scratch = vector<uint16_t>{encode(I::LD_I_a, 0, 0, SCRATCH_ADDR)};
+	// The RET after the loop's JP
+	auto ret_addr = C8_PROG_START + C8_INS_LEN * (LOOP_INS_CNT + 1);
+
+	vector<Workload> ret;
+	auto add = [&ret](string name, vector<uint8_t> rom) {
+		ret.push_back(step_workload("step/" + name, std::move(rom)));
+	};
+	add("ld", make_rom({}, [&](unsigned) {
+			return encode(I::LD_v_b, reg(), 0, byte());
+		}));
+	add("alu", make_rom({}, [&](unsigned) {
+			auto type = pick(
+				{I::OR_v_v, I::AND_v_v, I::XOR_v_v, I::ADD_v_v, I::SUB_v_v,
+				 I::SUBN_v_v, I::ADD_v_b}
+			);
+			return type == I::ADD_v_b ? encode(type, reg(), 0, byte())
+									  : encode(type, reg(), reg());
+		}));
+	add("skip", make_rom({}, [&](unsigned) {
+			auto type = pick({I::SE_v_b, I::SNE_v_b, I::SE_v_v, I::SNE_v_v});
+			bool is_byte = type == I::SE_v_b || type == I::SNE_v_b;
+			return is_byte ? encode(type, reg(), 0, byte() % 2)
+						   : encode(type, reg(), reg());
+		}));
+	add("jp", make_rom({}, [&](unsigned i) {
+			return encode(I::JP_a, 0, 0, next_addr(i));
+		}));
+	add("call_ret", make_rom({}, [&](unsigned) {
+			return encode(I::CALL_a, 0, 0, ret_addr);
+		}));
+	add("index", make_rom({}, [&](unsigned) {
+			auto type = pick({I::LD_I_a, I::ADD_I_v, I::LD_F_v});
+			return type == I::LD_I_a ? encode(type, 0, 0, SCRATCH_ADDR)
+									 : encode(type, reg());
+		}));
+	add("mem", make_rom(scratch, [&](unsigned) {
+			return encode(pick({I::LD_IM_v, I::LD_v_IM}), reg());
+		}));
+	add("bcd", make_rom(scratch, [&](unsigned) {
+			return encode(I::LD_B_v, reg());
+		}));
+	add("rnd", make_rom({}, [&](unsigned) {
+			return encode(I::RND_v_b, reg(), 0, byte());
+		}));
+	add("timers", make_rom({}, [&](unsigned) {
+			return encode(pick({I::LD_DT_v, I::LD_ST_v, I::LD_v_DT}), reg());
+		}));
+
+	// Sprites from the fonts, at x aligned to a byte or not
+	for (unsigned height : {1, 5, 10, 15}) {
+		for (unsigned x : {0, 3}) {
+			vector<uint16_t> setup = {
+				encode(I::LD_v_b, 0, 0, x), encode(I::LD_v_b, 1, 0, 8),
+				encode(I::LD_I_a, 0, 0, 0)
+			};
+			add("drw_h" + std::to_string(height) + "_x" + std::to_string(x),
+				make_rom(setup, [&](unsigned) {
+					return encode(I::DRW_v_v_n, 0, 1, height);
+				}));
+		}
+	}
+	return ret;
+}
+
+static vector<Workload> decoder_workloads()
+{
+	// Every word in turn
+	auto decode = [](uint64_t ops) {
+		unsigned sink = 0;
+		for (uint64_t i = 0; i < ops; ++i)
+			sink += unsigned(DecodedIns(uint16_t(i)).type);
+		volatile unsigned keep = sink;
+		(void)keep;
+	};
+	auto to_string = [](uint64_t ops) {
+		size_t sink = 0;
+		for (uint64_t i = 0; i < ops; ++i)
+			sink += DecodedIns(uint16_t(i)).to_string().size();
+		volatile size_t keep = sink;
+		(void)keep;
+	};
+	return {{"decode", "word", decode}, {"to_string", "word", to_string}};
+}
+
+static bool program_workloads(vector<Workload> &out)
+{
+	for (auto &[name, source] : PROGRAMS) {
+		vector<string_view> lines;
+		for (auto text = source; !text.empty();) {
+			auto nl = text.find('\n');
+			lines.push_back(text.substr(0, nl));
+			text.remove_prefix(nl == string_view::npos ? text.size() : nl + 1);
+		}
+		auto rom = Parser(lines).parse_and_assemble();
+		if (!rom) {
+			clog << "Bundled program '" << name << "' has errors\n";
+			return false;
+		}
+		out.push_back(step_workload("rom/" + string(name), std::move(*rom)));
+	}
+	return true;
+}
+
+struct Result {
+	uint64_t ops = 0;
+	double seconds = 0;
+};
+
+static double time_run(const Workload &work, uint64_t ops)
+{
+	auto start = std::chrono::steady_clock::now();
+	work.run(ops);
+	std::chrono::duration<double> took = std::chrono::steady_clock::now() - start;
+	return took.count();
+}
+
+/// @brief Best time of an op over batches, repeated till min_seconds are
+/// spent in total
+static Result measure(const Workload &work, double min_seconds)
+{
+	constexpr int MIN_RUNS = 3;
+	uint64_t ops = 1024;
+	double total = 0;
+	for (double took = 0; took < MIN_BATCH_SECONDS; ops *= 2) {
+		took = time_run(work, ops);
+		total += took;
+	}
+
+	Result best;
+	for (int i = 0; i < MIN_RUNS || total < min_seconds; ++i) {
+		auto took = time_run(work, ops);
+		total += took;
+		if (i == 0 || took < best.seconds)
+			best = {ops, took};
+	}
+	return best;
+}
+
+static void print_usage(const char *name)
+{
+	clog << "Usage: " << name << " [options]\n"
+		 << "Options:\n"
+		 << "  --filter <text>  Only workloads whose name has <text>\n"
+		 << "  --min-time <s>   Seconds to spend on each workload at least\n"
+		 << "                   (default: 0.3)\n"
+		 << "  --json           Print results as a JSON array\n";
+}
+
+int main(int argc, char const **argv)
+{
+	auto name = argc > 0 ? argv[0] : "c8emu_bench";
+	string_view filter;
+	double min_seconds = 0.3;
+	bool is_json = false;
+	for (int i = 1; i < argc; ++i) {
+		string_view arg = argv[i];
+		if (arg == "--filter" && i + 1 < argc) {
+			filter = argv[++i];
+		} else if (arg == "--min-time" && i + 1 < argc) {
+			min_seconds = std::strtod(argv[++i], nullptr);
+		} else if (arg == "--json") {
+			is_json = true;
+		} else {
+			print_usage(name);
+			return 1;
+		}
+	}
+
+	auto workloads = step_workloads();
+	auto decoders = decoder_workloads();
+	workloads.insert(workloads.end(), decoders.begin(), decoders.end());
+	if (!program_workloads(workloads))
+		return 1;
+
+	if (is_json)
+		std::printf("[");
+	else
+		std::printf("%-16s %-5s %10s %14s\n", "name", "unit", "ns/op", "ops/s");
+	bool is_first = true;
+	for (auto &work : workloads) {
+		if (work.name.find(filter) == string::npos)
+			continue;
+		auto result = measure(work, min_seconds);
+		auto ns = result.seconds * 1e9 / result.ops;
+		if (is_json) {
+			std::printf(
+				"%s\n  {\"name\": \"%s\", \"unit\": \"%s\", \"ns_per_op\": %.3f, "
+				"\"ops_per_sec\": %.0f}",
+				is_first ? "" : ",", work.name.c_str(), work.unit, ns, 1e9 / ns
+			);
+		} else {
+			std::printf(
+				"%-16s %-5s %10.3f %14.0f\n", work.name.c_str(), work.unit, ns,
+				1e9 / ns
+			);
+		}
+		is_first = false;
+		std::fflush(stdout);
+	}
+	if (is_json)
+		std::printf("\n]\n");
+
+	return 0;
+}
@@ -0,0 +1,400 @@
+#include <cctype>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "breakpoints.hxx"
+#include "emulator.hxx"
+
+using std::string_view;
+
+/// @brief Recursive descent parser of a condition emitting the bytecode
+class ConditionCompiler
+{
+public:
+	explicit ConditionCompiler(string_view source)
+		: text(source)
+	{
+	}
+
+	std::optional<Condition> compile(std::string &error)
+	{
+		skip_space();
+		if (parse_binary(0) && !at_end())
+			fail("Expected an operator");
+		if (!message.empty()) {
+			error = message + (at_end() ? " at the end"
+				: " at '" + std::string(text.substr(pos)) + "'");
+			return std::nullopt;
+		}
+		return std::move(cond);
+	}
+
+private:
+	using Op = Condition::Op;
+
+	struct Binary {
+		string_view token;
+		int precedence;
+		Op op;
+	};
+	/// Longer tokens first so that "<=" is not read as "<"
+	static constexpr Binary BINARIES[] = {
+		{"||", 1, Op::LOR}, {"&&", 2, Op::LAND}, {"==", 6, Op::EQ},
+		{"!=", 6, Op::NE}, {"<=", 7, Op::LE}, {">=", 7, Op::GE},
+		{"|", 3, Op::OR}, {"^", 4, Op::XOR}, {"&", 5, Op::AND},
+		{"<", 7, Op::LT}, {">", 7, Op::GT}, {"+", 8, Op::ADD},
+		{"-", 8, Op::SUB},
+	};
+
+	string_view text;
+	std::size_t pos = 0;
+	Condition cond;
+	int depth = 0;
+	std::string message;
+
+	bool at_end() const { return pos == text.size(); }
+
+	bool fail(std::string msg)
+	{
+		if (message.empty())
+			message = std::move(msg);
+		return false;
+	}
+
+	void skip_space()
+	{
+		while (!at_end() && std::isspace(static_cast<unsigned char>(text[pos])))
+			++pos;
+	}
+
+	bool accept(string_view token)
+	{
+		if (text.substr(pos, token.size()) != token)
+			return false;
+		pos += token.size();
+		skip_space();
+		return true;
+	}
+
+	bool emit(Op op, std::int32_t arg = 0)
+	{
+		switch (op) {
+		case Op::NOT:
+		case Op::NEG:
+		case Op::RAM:
+			break;
+		case Op::PUSH:
+		case Op::REG:
+		case Op::INDEX:
+		case Op::PC:
+		case Op::SP:
+		case Op::DT:
+		case Op::ST:
+		case Op::KEY:
+		case Op::HITS:
+			if (++depth > Condition::MAX_DEPTH)
+				return fail("Condition is too deep");
+			break;
+		default:
+			--depth;
+		}
+		cond.code.push_back({op, arg});
+		return true;
+	}
+
+	const Binary *binary_at() const
+	{
+		for (auto &b : BINARIES) {
+			if (text.substr(pos, b.token.size()) == b.token)
+				return &b;
+		}
+		return nullptr;
+	}
+
+	// Precedence climbing, all the binary operators are left associative
+	bool parse_binary(int min_precedence)
+	{
+		if (!parse_unary())
+			return false;
+		while (auto b = binary_at()) {
+			if (b->precedence <= min_precedence)
+				break;
+			accept(b->token);
+			if (!parse_binary(b->precedence) || !emit(b->op))
+				return false;
+		}
+		return true;
+	}
+
+	bool parse_unary()
+	{
+		// "!=" cannot start an operand, "!" is enough to tell
+		if (accept("!"))
+			return parse_unary() && emit(Op::NOT);
+		if (accept("-"))
+			return parse_unary() && emit(Op::NEG);
+		return parse_primary();
+	}
+
+	bool parse_primary()
+	{
+		if (accept("(")) {
+			if (!parse_binary(0))
+				return false;
+			return accept(")") || fail("Expected ')'");
+		}
+		if (accept("[")) {
+			if (!parse_binary(0))
+				return false;
+			return (accept("]") || fail("Expected ']'")) && emit(Op::RAM);
+		}
+		if (at_end())
+			return fail("Expected an operand");
+
+		auto start = pos;
+		while (!at_end() && std::isalnum(static_cast<unsigned char>(text[pos])))
+			++pos;
+		auto word = text.substr(start, pos - start);
+		std::string name;
+		for (auto c : word)
+			name += std::tolower(static_cast<unsigned char>(c));
+		skip_space();
+
+		if (name.empty()) {
+			pos = start;
+			return fail("Expected an operand");
+		}
+		if (std::isdigit(static_cast<unsigned char>(name[0])))
+			return parse_number(name, start);
+		if (name.size() == 2 && name[0] == 'v'
+			&& std::isxdigit(static_cast<unsigned char>(name[1]))) {
+			int reg = std::isdigit(static_cast<unsigned char>(name[1]))
+				? name[1] - '0' : name[1] - 'a' + 10;
+			return emit(Op::REG, reg);
+		}
+
+		static constexpr struct {
+			string_view name;
+			Op op;
+		} NAMES[] = {
+			{"i", Op::INDEX}, {"pc", Op::PC}, {"sp", Op::SP},
+			{"dt", Op::DT}, {"st", Op::ST}, {"key", Op::KEY},
+			{"hits", Op::HITS},
+		};
+		for (auto &n : NAMES) {
+			if (name == n.name)
+				return emit(n.op);
+		}
+		pos = start;
+		return fail("Unknown name '" + std::string(word) + "'");
+	}
+
+	bool parse_number(const std::string &digits, std::size_t start)
+	{
+		unsigned base = 10;
+		std::size_t i = 0;
+		if (digits.size() > 2 && digits[0] == '0'
+			&& (digits[1] == 'x' || digits[1] == 'b')) {
+			base = digits[1] == 'x' ? 16 : 2;
+			i = 2;
+		}
+		std::int32_t value = 0;
+		for (; i < digits.size(); ++i) {
+			auto c = static_cast<unsigned char>(digits[i]);
+			unsigned digit = std::isdigit(c) ? c - '0'
+				: c >= 'a' && c <= 'f' ? c - 'a' + 10 : base;
+			if (digit >= base) {
+				pos = start;
+				return fail("Bad number '" + digits + "'");
+			}
+			// Bigger than anything it may be compared to
+			if ((value = value * base + digit) > 0xFFFF) {
+				pos = start;
+				return fail("Number '" + digits + "' is too big");
+			}
+		}
+		return emit(Op::PUSH, value);
+	}
+};
+
+std::optional<Condition>
+Condition::compile(string_view text, std::string &error)
+{
+	return ConditionCompiler(text).compile(error);
+}
+
+bool Condition::eval(const Emulator &emu, std::uint64_t hits) const
+{
+	// Operands are at most 16 bits and the stack at most MAX_DEPTH deep,
+	// so sums and differences cannot overflow
+	std::int64_t stack[MAX_DEPTH];
+	int top = -1;
+	for (auto ins : code) {
+		switch (ins.op) {
+		case Op::PUSH:
+			stack[++top] = ins.arg;
+			continue;
+		case Op::REG:
+			stack[++top] = emu.regs[ins.arg];
+			continue;
+		case Op::INDEX:
+			stack[++top] = emu.index;
+			continue;
+		case Op::PC:
+			stack[++top] = emu.pc;
+			continue;
+		case Op::SP:
+			stack[++top] = emu.sp;
+			continue;
+		case Op::DT:
+			stack[++top] = emu.delay_timer();
+			continue;
+		case Op::ST:
+			stack[++top] = emu.sound_timer();
+			continue;
+		case Op::KEY:
+			stack[++top] = emu.key;
+			continue;
+		case Op::HITS:
+			stack[++top] = hits;
+			continue;
+		default:
+			break;
+		}
+
+		auto &a = stack[top];
+		switch (ins.op) {
+		case Op::RAM:
+			a = emu.memory()[a & (C8_RAM_SIZE - 1)];
+			continue;
+		case Op::NOT:
+			a = !a;
+			continue;
+		case Op::NEG:
+			a = -a;
+			continue;
+		default:
+			break;
+		}
+
+		// Binary operators pop b and replace a with the result
+		auto b = stack[top--];
+		auto &l = stack[top];
+		switch (ins.op) {
+		case Op::ADD:
+			l += b;
+			break;
+		case Op::SUB:
+			l -= b;
+			break;
+		case Op::LT:
+			l = l < b;
+			break;
+		case Op::LE:
+			l = l <= b;
+			break;
+		case Op::GT:
+			l = l > b;
+			break;
+		case Op::GE:
+			l = l >= b;
+			break;
+		case Op::EQ:
+			l = l == b;
+			break;
+		case Op::NE:
+			l = l != b;
+			break;
+		case Op::AND:
+			l &= b;
+			break;
+		case Op::XOR:
+			l ^= b;
+			break;
+		case Op::OR:
+			l |= b;
+			break;
+		case Op::LAND:
+			l = l && b;
+			break;
+		case Op::LOR:
+			l = l || b;
+			break;
+		default:
+			break;
+		}
+	}
+	return stack[0] != 0;
+}
+
+bool Breakpoints::add(string_view spec, std::string &error)
+{
+	auto end = spec.find_first_of(" \t");
+	auto addr = parse_address(spec.substr(0, end));
+	if (!addr) {
+		error = "Bad address '" + std::string(spec.substr(0, end)) + "'";
+		return false;
+	}
+
+	std::optional<Condition> cond;
+	if (end != string_view::npos) {
+		auto rest = spec.substr(end);
+		auto start = rest.find_first_not_of(" \t");
+		rest.remove_prefix(start == string_view::npos ? rest.size() : start);
+		auto is_if = rest.substr(0, 2) == "if" && (rest.size() == 2
+			|| std::isspace(static_cast<unsigned char>(rest[2])));
+		if (!is_if) {
+			error = "Expected 'if <condition>' after the address";
+			return false;
+		}
+		if (!(cond = Condition::compile(rest.substr(2), error)))
+			return false;
+	}
+
+	exec[*addr] = true;
+	if (cond)
+		conditions.insert_or_assign(*addr, std::move(*cond));
+	else
+		conditions.erase(*addr);
+	return true;
+}
+
+void Breakpoints::toggle(std::uint16_t addr)
+{
+	exec.flip(addr);
+	conditions.erase(addr);
+}
+
+bool Breakpoints::is_hit(const Emulator &emu)
+{
+	auto addr = emu.pc % C8_RAM_SIZE;
+	auto count = ++hits[addr];
+	auto it = conditions.find(addr);
+	return it == conditions.end() || it->second.eval(emu, count);
+}
+
+std::optional<std::uint16_t> parse_address(string_view text)
+{
+	if (text.substr(0, 2) == "0x" || text.substr(0, 2) == "0X")
+		text.remove_prefix(2);
+	if (text.empty() || text.size() > 3)
+		return std::nullopt;
+
+	std::uint16_t ret = 0;
+	for (auto c : text) {
+		unsigned digit;
+		if (c >= '0' && c <= '9')
+			digit = c - '0';
+		else if (c >= 'a' && c <= 'f')
+			digit = c - 'a' + 10;
+		else if (c >= 'A' && c <= 'F')
+			digit = c - 'A' + 10;
+		else
+			return std::nullopt;
+		ret = ret << 4 | digit;
+	}
+	return ret;
+}
@@ -0,0 +1,99 @@
+#ifndef CHIP8_BREAKPOINTS_HXX_INCLUDED
+#define CHIP8_BREAKPOINTS_HXX_INCLUDED
+
+#include <bitset>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "chip8.hxx"
+
+class Emulator;
+
+/// @brief Condition of a breakpoint, compiled once to the bytecode of a
+/// stack machine and evaluated each time the breakpoint is reached.
+/// Conditions are C-like expressions of numbers(decimal, 0x hex or 0b
+/// binary), the registers V0 to VF, I, PC, SP, DT and ST, KEY (16 for no
+/// key), HITS (times the breakpoint was reached, this time included) and
+/// [addr] for a byte of RAM, with the operators ! - + == != < <= > >= & ^ |
+/// && || and parentheses. They are true when not 0.
+class Condition
+{
+public:
+	/// @return The compiled condition, nullopt with the error in error
+	static std::optional<Condition>
+	compile(std::string_view text, std::string &error);
+	bool eval(const Emulator &emu, std::uint64_t hits) const;
+
+private:
+	enum class Op : std::uint8_t {
+		PUSH,
+		REG,
+		INDEX,
+		PC,
+		SP,
+		DT,
+		ST,
+		KEY,
+		HITS,
+		RAM,
+		NOT,
+		NEG,
+		ADD,
+		SUB,
+		LT,
+		LE,
+		GT,
+		GE,
+		EQ,
+		NE,
+		AND,
+		XOR,
+		OR,
+		LAND,
+		LOR,
+	};
+	struct Ins {
+		Op op;
+		/// Value of PUSH, register of REG
+		std::int32_t arg = 0;
+	};
+	/// Deepest the stack may get, deeper conditions do not compile
+	static constexpr int MAX_DEPTH = 16;
+
+	std::vector<Ins> code;
+
+	friend class ConditionCompiler;
+};
+
+/// @brief Addresses for Emulator::run() to stop at: before executing an
+/// instruction at a breakpoint whose condition, if any, is true, after an
+/// instruction writing to a watched address. Only LD B, Vx and LD [I], Vx
+/// write to RAM.
+struct Breakpoints {
+	std::bitset<C8_RAM_SIZE> exec;
+	std::bitset<C8_RAM_SIZE> write;
+	/// Conditions of the breakpoints having one
+	std::map<std::uint16_t, Condition> conditions;
+	/// Times each breakpoint was reached, whether it stopped there or not
+	std::uint64_t hits[C8_RAM_SIZE]{};
+
+	bool any() const { return exec.any() || write.any(); }
+	/// @brief Add a breakpoint from "<addr>" or "<addr> if <condition>",
+	/// the address in hex
+	/// @return false with the error in error if it does not parse
+	bool add(std::string_view spec, std::string &error);
+	/// @brief Add a breakpoint without a condition, or remove the one there
+	void toggle(std::uint16_t addr);
+	/// @brief Count a hit of the breakpoint at PC and evaluate its condition
+	/// @return Whether to stop there
+	bool is_hit(const Emulator &emu);
+};
+
+/// @brief Parse a RAM address in hex, with or without 0x
+std::optional<std::uint16_t> parse_address(std::string_view text);
+
+#endif // END breakpoints.hxx
@@ -0,0 +1,694 @@
+// Emulator conformance suite: runs small bundled programs, which are
+// assembled at start, for a fixed number of steps without a window and
+// checks the registers and a hash of the screen against the expected ones.
+// Together the programs execute every instruction, so a change to the
+// emulator's fast paths can be checked in a fraction of a second.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "chip8.hxx"
+#include "decoder.hxx"
+#include "emulator.hxx"
+#include "parser.hxx"
+
+using std::clog;
+using std::string;
+using std::string_view;
+using std::uint64_t;
+using std::vector;
+
+/// Steps each program is run for, they end in a loop well before
+constexpr unsigned STEPS = 1000;
+
+/// @brief A program and the state expected after running it, with the
+/// default quirks unless it is about others. The state is "NAME=hex" pairs,
+/// like c8conform --print shows them: V0 to VF, I, PC, SP, DT, ST and
+/// screen, the hash of the screen. Names left out are not checked.
+struct Case {
+	string_view name;
+	string_view source;
+	string_view expected;
+	/// Key held down for the whole run
+	unsigned key = C8_KEY_NONE;
+	QuirkProfile quirks = QuirkProfile::DEFAULT;
+};
+
+static const Case CASES[] = {
+	{"load", R"(
+	ld v0, 0x12
+	ld vE, 0xFF
+	ld v1, v0
+	ld vF, vE
+	ld v2, 0
+halt:
+	jp halt
+)", "V0=12 V1=12 V2=00 VE=FF VF=FF PC=020A"},
+	{"add_byte_wrap", R"(
+	ld v0, 0xFF
+	ld vF, 7
+	add v0, 2
+	add v1, 0x80
+	add v1, 0x80
+halt:
+	jp halt
+)", "V0=01 V1=00 VF=07"},
+	{"logic", R"(
+	ld v0, 0b1100
+	ld v1, 0b1010
+	ld v2, v0
+	ld v3, v0
+	ld vF, 5
+	or v0, v1
+	and v2, v1
+	xor v3, v1
+	xor v1, v1
+halt:
+	jp halt
+)", "V0=0E V1=00 V2=08 V3=06 VF=05"},
+	{"add_carry", R"(
+	ld v0, 0xFF
+	ld v1, 2
+	add v0, v1
+	ld v4, vF
+	ld v2, 0x10
+	ld v3, 0x20
+	add v2, v3
+	ld v5, vF
+	ld v6, 0x80
+	add v6, v6
+halt:
+	jp halt
+)", "V0=01 V2=30 V4=01 V5=00 V6=00 VF=01"},
+	// VF is 1 when there is no borrow, Vx >= Vy, so x - 0 sets it
+	{"sub_borrow", R"(
+	ld v0, 5
+	ld v1, 3
+	sub v0, v1
+	ld vA, vF
+	ld v2, 3
+	ld v3, 5
+	sub v2, v3
+	ld vB, vF
+	ld v4, 5
+	ld v5, 5
+	sub v4, v5
+	ld vC, vF
+	ld v6, 5
+	ld v7, 0
+	sub v6, v7
+	ld vD, vF
+halt:
+	jp halt
+)", "V0=02 V2=FE V4=00 V6=05 VA=01 VB=00 VC=01 VD=01"},
+	{"subn", R"(
+	ld v0, 3
+	ld v1, 5
+	subn v0, v1
+	ld vA, vF
+	ld v2, 5
+	ld v3, 3
+	subn v2, v3
+	ld vB, vF
+halt:
+	jp halt
+)", "V0=02 V2=FE VA=01 VB=00"},
+	// Vy is not used by SHR and SHL, 8416 is SHR V4 with V1 in Vy
+	{"shift", R"(
+	ld v0, 0x01
+	shr v0
+	ld vA, vF
+	ld v1, 0x80
+	shl v1
+	ld vB, vF
+	ld v2, 0x80
+	shr v2
+	ld vC, vF
+	ld v3, 0x01
+	shl v3
+	ld vD, vF
+	ld v4, 0x10
+	dw 0x8416
+halt:
+	jp halt
+)", "V0=00 V1=00 V2=40 V3=02 V4=08 VA=01 VB=01 VC=00 VD=00"},
+	// The flag is stored after the result, so VF holds it when it is Vx
+	{"flag_result", R"(
+	ld vF, 0xFF
+	ld v0, 1
+	add vF, v0
+	ld v1, vF
+	ld vF, 0x10
+	add vF, v0
+	ld v2, vF
+	ld vF, 3
+	sub vF, v0
+	ld v3, vF
+	ld vF, 0x81
+	shr vF
+	ld v4, vF
+	ld vF, 0x40
+	shl vF
+halt:
+	jp halt
+)", "V1=01 V2=00 V3=01 V4=01 VF=00"},
+	// 5xy1 is SE with a low nibble which is not checked
+	{"skips", R"(
+	ld v1, 5
+	ld v2, 5
+	ld v3, 6
+	se v1, 5
+	ld v0, 0xEE
+	sne v1, 5
+	add v4, 1
+	se v1, v2
+	ld v0, 0xEE
+	sne v1, v3
+	ld v0, 0xEE
+	se v1, v3
+	add v4, 1
+	sne v1, v2
+	add v4, 1
+	se v1, 6
+	add v4, 1
+	sne v1, 6
+	ld v0, 0xEE
+	dw 0x5121
+	ld v0, 0xEE
+halt:
+	jp halt
+)", "V0=00 V4=04"},
+	{"call_ret", R"(
+	call first
+	add v0, 1
+halt:
+	jp halt
+first:
+	add v1, 1
+	call second
+	add v1, 1
+	ret
+second:
+	add v2, 1
+	ret
+)", "V0=01 V1=02 V2=01 SP=00 PC=0204"},
+	// The 17th call overwrites the first return address, so the return
+	// from it goes back into rec instead of to the start
+	{"stack_wrap", R"(
+	call rec
+	ld v1, 0xEE
+halt:
+	jp halt
+rec:
+	add v0, 1
+	sne v0, 17
+	ret
+	call rec
+	ld v2, 1
+end:
+	jp end
+)", "V0=11 V1=00 V2=01 SP=10"},
+	{"jumps", R"(
+	sys 0x123
+	ld v0, 4
+	jp v0, table
+	ld v1, 0xEE
+table:
+	jp wrong
+	jp wrong
+	jp right
+wrong:
+	ld v1, 0xEE
+right:
+	ld v2, 1
+	jp halt
+	ld v1, 0xEE
+halt:
+	jp halt
+)", "V1=00 V2=01"},
+	{"index", R"(
+	ld v0, 0x10
+	ld I, 0x123
+	add I, v0
+halt:
+	jp halt
+)", "I=0133"},
+	{"font", R"(
+	ld v0, 0xA
+	ld F, v0
+	ld v1, [I]
+halt:
+	jp halt
+)", "V0=F0 V1=90 I=0032"},
+	{"bcd", R"(
+	ld I, scratch
+	ld v0, 254
+	ld B, v0
+	ld v2, [I]
+	ld v3, v0
+	ld v4, v1
+	ld v5, v2
+	ld v0, 7
+	ld B, v0
+	ld v2, [I]
+halt:
+	jp halt
+scratch:
+	db 0, 0, 0
+)", "V0=00 V1=00 V2=07 V3=02 V4=05 V5=04"},
+	// I is left as it is, it is not advanced past the registers
+	{"store_load", R"(
+	ld I, scratch
+	ld v0, 1
+	ld v1, 2
+	ld v2, 3
+	ld v3, 4
+	ld [I], v2
+	ld v0, 0
+	ld v1, 0
+	ld v2, 0
+	ld v3, 0
+	ld v1, [I]
+halt:
+	jp halt
+scratch:
+	db 0, 0, 0, 0
+)", "V0=01 V1=02 V2=00 V3=00 I=0218"},
+	// Memory wraps around at the end of RAM: the last two bytes are at
+	// 0xFFE, then 0x000 and 0x001 of the font
+	{"memory_wrap", R"(
+	ld I, 0xFFE
+	ld v0, 0x11
+	ld v1, 0x22
+	ld v2, 0x33
+	ld v3, 0x44
+	ld [I], v3
+	ld I, 0
+	ld v1, [I]
+	ld v4, v0
+	ld v5, v1
+	ld v0, 0
+	ld v1, 0
+	ld I, 0xFFF
+	ld v2, [I]
+halt:
+	jp halt
+)", "V0=22 V1=33 V2=44 V4=33 V5=44"},
+	// The program runs off the end of RAM into 0x000, where it wrote an
+	// instruction, then runs into the font: 9090 is SNE V0, V9, then F020 is
+	// illegal
+	{"pc_wrap", R"(
+	ld I, 0xFFE
+	ld v0, 0x6A
+	ld v1, 0x2A
+	ld v2, 0x6B
+	ld v3, 0x2B
+	ld [I], v3
+	ld v0, 0
+	ld v1, 0
+	ld v2, 0
+	ld v3, 0
+	jp 0xFFE
+)", "VA=2A VB=2B PC=1004"},
+	// Random bytes are masked, portable without the generator's values
+	{"rnd_mask", R"(
+	ld v5, 50
+loop:
+	rnd v0, 0x00
+	or v4, v0
+	rnd v1, 0x0F
+	ld v2, 0xF0
+	and v2, v1
+	or v3, v2
+	add v5, 255
+	se v5, 0
+	jp loop
+halt:
+	jp halt
+)", "V3=00 V4=00 V5=00"},
+	// Timers count down by 60 / 300 a step
+	{"timers", R"(
+	ld v0, 30
+	ld DT, v0
+	ld ST, v0
+	ld v2, DT
+loop:
+	add v1, 1
+	ld v3, DT
+	se v3, 0
+	jp loop
+halt:
+	jp halt
+)", "V2=1E V1=25 V3=00 DT=00 ST=00"},
+	{"timers_running", R"(
+	ld v0, 250
+	ld DT, v0
+	ld v0, 100
+	ld ST, v0
+halt:
+	jp halt
+)", "DT=32 ST=00"},
+	{"key_held", R"(
+	ld v0, 7
+	ld v1, 8
+	skp v0
+	ld vA, 0xEE
+	skp v1
+	add v4, 1
+	sknp v0
+	add v4, 1
+	sknp v1
+	ld vA, 0xEE
+	ld v5, K
+halt:
+	jp halt
+)", "V4=02 V5=07 VA=00", 7},
+	{"key_none", R"(
+	ld v0, 7
+	skp v0
+	add v4, 1
+	sknp v0
+	ld vA, 0xEE
+	ld v5, K
+	ld v6, 1
+halt:
+	jp halt
+)", "V4=01 V5=00 V6=00 VA=00 PC=020A"},
+	{"draw", R"(
+	ld v0, 3
+	ld v1, 2
+	ld v2, 0xB
+	ld F, v2
+	drw v0, v1, 5
+	ld vA, vF
+	ld v0, 10
+	ld I, sprite
+	drw v0, v1, 3
+	ld vB, vF
+	drw v0, v1, 1
+halt:
+	jp halt
+sprite:
+	db 0b10000001, 0b01011010, 0xFF
+)", "VA=00 VB=00 VF=01 screen=2096CC0649E7788A"},
+	{"draw_erase", R"(
+	ld v0, 20
+	ld v1, 10
+	ld v2, 8
+	ld F, v2
+	drw v0, v1, 5
+	drw v0, v1, 5
+	ld vA, vF
+	ld v0, 0
+	ld v1, 0
+	drw v0, v1, 0
+halt:
+	jp halt
+)", "VA=01 VF=00 screen=D80AC658736BB725"},
+	// Sprites wrap around the edges of the screen, coordinates too
+	{"draw_wrap", R"(
+	ld I, sprite
+	ld v0, 60
+	ld v1, 30
+	drw v0, v1, 4
+	ld v0, 68
+	ld v1, 34
+	drw v0, v1, 1
+halt:
+	jp halt
+sprite:
+	db 0xFF, 0x81, 0x81, 0xFF
+)", "VF=00 screen=F960794328A6EB26"},
+	{"draw_tall", R"(
+	ld I, 0
+	ld v0, 62
+	ld v1, 1
+	drw v0, v1, 15
+halt:
+	jp halt
+)", "VF=00 screen=6544C78832B60F6C"},
+	{"cls", R"(
+	ld v0, 0
+	ld F, v0
+	drw v0, v0, 5
+	cls
+	drw v0, v0, 5
+	ld vA, vF
+	cls
+halt:
+	jp halt
+)", "VA=00 screen=D80AC658736BB725"},
+	// Shifts of Vy(8016 is SHR V0 and 821E SHL V2, both with V1 in Vy), VF
+	// reset by logic, I advanced by loads and stores and sprites cut at the
+	// edges
+	{"quirks_vip", R"(
+	ld v1, 0x81
+	dw 0x8016
+	ld vA, vF
+	dw 0x821E
+	ld vB, vF
+	ld vF, 1
+	or v3, v1
+	ld vC, vF
+	ld I, sprite
+	ld v6, 60
+	ld v7, 30
+	drw v6, v7, 4
+	ld I, scratch
+	ld [I], v1
+	ld I, scratch
+	ld v1, [I]
+halt:
+	jp halt
+sprite:
+	db 0xFF, 0xFF, 0xFF, 0xFF
+scratch:
+	db 0, 0
+)", "V0=40 V1=81 V2=02 V3=81 VA=01 VB=01 VC=00 I=0228 "
+	 "screen=6B751AB60806AB85", C8_KEY_NONE,
+	 QuirkProfile::VIP},
+	// JP V0, a jumps by Vx of the high nibble of a, table is at 0x206 so by
+	// V2. Sprites are cut at the edges.
+	{"quirks_schip", R"(
+	ld v0, 0xEE
+	ld v2, 4
+	jp v0, table
+table:
+	jp table
+	jp table
+	jp right
+right:
+	ld v1, 1
+	ld I, 0
+	ld v6, 62
+	ld v7, 31
+	drw v6, v7, 2
+halt:
+	jp halt
+)", "V1=01 screen=D80AC358736BB20C", C8_KEY_NONE, QuirkProfile::SCHIP},
+	// Stays at an illegal instruction
+	{"illegal", R"(
+	ld v0, 1
+	dw 0x800F
+	ld v0, 2
+)", "V0=01 PC=0202"},
+};
+
+/// @brief A piece of the emulator's state, width is in hex digits
+struct Field {
+	string name;
+	uint64_t value;
+	int width;
+};
+
+/// @brief 64-bit FNV-1a of the screen, rows top to bottom, 8 pixels a byte
+/// with the leftmost pixel in the high bit
+static uint64_t screen_hash(const Emulator &emu)
+{
+	uint64_t hash = 0xCBF29CE484222325;
+	for (int y = 0; y < C8_SCREEN_HEIGHT; ++y) {
+		auto &row = emu.screen_row(y);
+		for (int x = 0; x < C8_SCREEN_WIDTH; x += 8) {
+			unsigned byte = 0;
+			for (int i = 0; i < 8; ++i)
+				byte = byte << 1 | row[x + i];
+			hash = (hash ^ byte) * 0x100000001B3;
+		}
+	}
+	return hash;
+}
+
+static vector<Field> state_fields(const Emulator &emu)
+{
+	vector<Field> ret;
+	for (int i = 0; i < C8_REG_CNT; ++i)
+		ret.push_back({string(REGISTERS[i]), emu.regs[i], 2});
+	ret.push_back({"I", emu.index, 4});
+	ret.push_back({"PC", emu.pc, 4});
+	ret.push_back({"SP", emu.sp, 2});
+	ret.push_back({"DT", emu.delay_timer(), 2});
+	ret.push_back({"ST", emu.sound_timer(), 2});
+	ret.push_back({"screen", screen_hash(emu), 16});
+	return ret;
+}
+
+static vector<string_view> split_lines(string_view text)
+{
+	vector<string_view> ret;
+	while (!text.empty()) {
+		auto nl = text.find('\n');
+		ret.push_back(text.substr(0, nl));
+		text.remove_prefix(nl == string_view::npos ? text.size() : nl + 1);
+	}
+	return ret;
+}
+
+/// @brief Run a case, marking the instructions executed as covered
+/// @return Fields of the state after the run
+static vector<Field> run_case(
+	const Case &test, const vector<uint8_t> &rom, bool covered[INSTRUCTION_CNT]
+)
+{
+	Emulator emu(rom.data(), rom.data() + rom.size());
+	emu.seed(1);
+	emu.set_step_time(1.0 / 300);
+	emu.key = test.key;
+	emu.set_quirks(QUIRK_PROFILES[static_cast<int>(test.quirks)]);
+	for (unsigned i = 0; i < STEPS; ++i) {
+		if (!emu.is_waiting_for_key())
+			covered[static_cast<int>(DecodedIns(emu.fetch_ins(emu.pc)).type)] = true;
+		if (!emu.step())
+			break;
+	}
+	return state_fields(emu);
+}
+
+/// @brief Compare the state with the expectations of a case, printing
+/// what differs
+/// @return Whether all of them match
+static bool check_case(const Case &test, const vector<Field> &state)
+{
+	bool ret = true;
+	for (auto text = test.expected; !text.empty();) {
+		auto end = text.find(' ');
+		auto pair = text.substr(0, end);
+		text.remove_prefix(end == string_view::npos ? text.size() : end + 1);
+		if (pair.empty())
+			continue;
+
+		auto eq = pair.find('=');
+		auto name = pair.substr(0, eq);
+		const Field *field = nullptr;
+		for (auto &f : state) {
+			if (f.name == name)
+				field = &f;
+		}
+		if (eq == string_view::npos || !field) {
+			std::printf(
+				"%s: bad expectation '%.*s'\n", string(test.name).c_str(),
+				int(pair.size()), pair.data()
+			);
+			ret = false;
+			continue;
+		}
+		auto expected = std::strtoull(string(pair.substr(eq + 1)).c_str(), nullptr, 16);
+		if (field->value != expected) {
+			std::printf(
+				"%s: %s is %0*llX, expected %0*llX\n",
+				string(test.name).c_str(), field->name.c_str(), field->width,
+				(unsigned long long)field->value, field->width,
+				(unsigned long long)expected
+			);
+			ret = false;
+		}
+	}
+	return ret;
+}
+
+static void print_state(const Case &test, const vector<Field> &state)
+{
+	std::printf("%s:", string(test.name).c_str());
+	for (auto &field : state)
+		std::printf(
+			" %s=%0*llX", field.name.c_str(), field.width,
+			(unsigned long long)field.value
+		);
+	std::printf("\n");
+}
+
+static void print_usage(const char *name)
+{
+	clog << "Usage: " << name << " [options]\n"
+		 << "Options:\n"
+		 << "  --filter <text>  Run only the cases whose name has <text>\n"
+		 << "  --print          Print the whole state after each case, in\n"
+		 << "                   the format of the expectations\n";
+}
+
+int main(int argc, char const **argv)
+{
+	string_view filter;
+	bool is_printing = false;
+	for (int i = 1; i < argc; ++i) {
+		string_view arg = argv[i];
+		if (arg == "--filter" && i + 1 < argc) {
+			filter = argv[++i];
+		} else if (arg == "--print") {
+			is_printing = true;
+		} else {
+			print_usage(argv[0]);
+			return 1;
+		}
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	bool covered[INSTRUCTION_CNT]{};
+	unsigned run = 0;
+	unsigned failed = 0;
+	for (auto &test : CASES) {
+		if (test.name.find(filter) == string_view::npos)
+			continue;
+		auto rom = Parser(split_lines(test.source)).parse_and_assemble();
+		if (!rom) {
+			clog << "Bundled case '" << test.name << "' has errors\n";
+			return 1;
+		}
+		auto state = run_case(test, *rom, covered);
+		run++;
+		if (is_printing)
+			print_state(test, state);
+		else if (!check_case(test, state))
+			failed++;
+	}
+	std::chrono::duration<double> took = std::chrono::steady_clock::now() - start;
+
+	// Only the whole suite has to cover every instruction
+	bool is_covered = true;
+	if (filter.empty()) {
+		for (int i = 0; i < INSTRUCTION_CNT; ++i) {
+			if (covered[i])
+				continue;
+			auto format = i + 1 == INSTRUCTION_CNT
+							  ? string_view("illegal instruction")
+							  : ins_format(Instruction(i));
+			std::printf(
+				"Not covered by any case: %.*s\n", int(format.size()),
+				format.data()
+			);
+			is_covered = false;
+		}
+	}
+	if (is_printing)
+		return 0;
+	std::printf(
+		"%u of %u cases passed in %.3f ms\n", run - failed, run,
+		took.count() * 1e3
+	);
+	return failed == 0 && is_covered ? 0 : 1;
+}
@@ -0,0 +1,39 @@
+#ifndef CHIP8_COUNTERS_HXX_INCLUDED
+#define CHIP8_COUNTERS_HXX_INCLUDED
+
+#include <cstdint>
+
+#include "chip8.hxx"
+
+/// @brief Event counters of an emulator, compiled in only with the
+/// C8_COUNTERS build option(cmake -DC8_COUNTERS=ON). Without it the
+/// emulator has no counters and C8_COUNT() expands to nothing.
+/// Counters are plain integers of each emulator, no atomics or sharing:
+/// add them up with += to aggregate runs.
+struct alignas(64) Counters {
+	/// Executions of each instruction type, ILLEGAL included
+	std::uint64_t ins[INSTRUCTION_CNT]{};
+	std::uint64_t skips_taken = 0;
+	std::uint64_t skips_not_taken = 0;
+	std::uint64_t collisions = 0;
+	std::uint64_t clears = 0;
+
+	Counters &operator+=(const Counters &other)
+	{
+		for (int i = 0; i < INSTRUCTION_CNT; ++i)
+			ins[i] += other.ins[i];
+		skips_taken += other.skips_taken;
+		skips_not_taken += other.skips_not_taken;
+		collisions += other.collisions;
+		clears += other.clears;
+		return *this;
+	}
+};
+
+#ifdef C8_COUNTERS
+#define C8_COUNT(counter) (counters.counter++)
+#else
+#define C8_COUNT(counter) ((void)0)
+#endif
+
+#endif // END counters.hxx
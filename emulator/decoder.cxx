@@ -147,6 +147,13 @@ static const string INSTRUCTION_FMT[] = {
 	"ADD I, x", "LD F, x",  "LD B, x",  "LD [I], x", "LD x, [I]",
 };
 
+string_view ins_format(Instruction type)
+{
+	if (type == Instruction::ILLEGAL)
+		return "ILLEGAL";
+	return INSTRUCTION_FMT[static_cast<int>(type)];
+}
+
 // Replaces once
 static void replace_char(string &s, char old, string_view new_)
 {
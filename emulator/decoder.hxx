@@ -2,6 +2,7 @@
 #define CHIP8_DECODER_HXX_INCLUDED
 
 #include <string>
+#include <string_view>
 #include "chip8.hxx"
 
 struct DecodedIns {
@@ -17,4 +18,7 @@ struct DecodedIns {
 	uint8_t nibble = 0;
 };
 
+/// @brief Operand format of an instruction type, like "LD x, b"
+std::string_view ins_format(Instruction type);
+
 #endif
\ No newline at end of file
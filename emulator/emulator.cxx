@@ -7,7 +7,11 @@
 
 #include "chip8.hxx"
 #include "emulator.hxx"
+#include "breakpoints.hxx"
 #include "decoder.hxx"
+#include "heatmap.hxx"
+#include "profile.hxx"
+#include "trace.hxx"
 
 using std::array;
 using std::begin;
@@ -20,35 +24,143 @@ static std::uniform_int_distribution<unsigned> random_byte_distbr(0, 255);
 
 Emulator::Emulator(const uint8_t *rom_beg, const uint8_t *rom_end)
 {
-	constexpr auto rom_max = C8_RAM_SIZE - C8_PROG_START;
-	if (rom_end - rom_beg > rom_max) {
-		std::clog << "Emulator: ROM size too big! "
-				  << "Maximum is " << rom_max << " bytes\n";
-		error = true;
+	if (!reset(rom_beg, rom_end))
 		return;
-	}
 
 	// Seed the random number generator
 	std::random_device rdev;
 	rand_gen.seed(rdev());
+}
+
+bool Emulator::reset(const uint8_t *rom_beg, const uint8_t *rom_end)
+{
+	constexpr auto rom_max = C8_RAM_SIZE - C8_PROG_START;
+	error = rom_end - rom_beg > rom_max;
+	if (error) {
+		std::clog << "Emulator: ROM size too big! "
+				  << "Maximum is " << rom_max << " bytes\n";
+		return false;
+	}
+
+	pc = C8_PROG_START;
+	index = 0;
+	sp = 0;
+	std::fill(begin(regs), end(regs), 0);
+	key = C8_KEY_NONE;
+	wait_for_key = false;
+	dtimer = 0;
+	stimer = 0;
+	key_reg = 0;
+	std::fill(begin(stack), end(stack), 0);
+	std::fill(begin(screen), end(screen), 0);
+	elapsed = 0;
+	stats = Stats();
+	stop = StopReason::NONE;
+	is_skipping_break = false;
+#ifdef C8_COUNTERS
+	counters = Counters();
+#endif
 
 	// Start the clock now!
 	reset_clock();
 
 	// Copy fonts to the begining of ROM.
 	auto fontp = reinterpret_cast<const uint8_t *>(FONT_SPRITES);
-	copy(fontp, fontp + sizeof(FONT_SPRITES), ram);
+	auto ram_end = copy(fontp, fontp + sizeof(FONT_SPRITES), ram);
+	std::fill(ram_end, end(ram), 0);
 
 	// Load program into the RAM from the ROM provided.
 	copy(rom_beg, rom_end, ram + C8_PROG_START);
+	return true;
 }
 
 bool Emulator::step()
+{
+	if (profile || call_graph)
+		return profiled_step();
+	if (tracer || heatmap)
+		return execute<true>();
+	return execute<false>();
+}
+
+std::uint64_t Emulator::run(std::uint64_t steps)
+{
+	auto start = steady_clock::now();
+	std::uint64_t done = 0;
+	stop = StopReason::NONE;
+	if (breakpoints && breakpoints->any()) {
+		done = run_checked(steps);
+	} else {
+		while (done < steps && step())
+			done++;
+		if (done < steps)
+			stop = StopReason::ILLEGAL;
+		is_skipping_break = false;
+	}
+	std::chrono::duration<double> took = steady_clock::now() - start;
+	stats.step_seconds += took.count();
+	return done;
+}
+
+std::uint64_t Emulator::run_checked(std::uint64_t steps)
+{
+	for (std::uint64_t done = 0; done < steps; ++done) {
+		// A step waiting for a key has stopped at the instruction already.
+		// Conditions are only evaluated at the addresses armed.
+		if (breakpoints->exec[pc % C8_RAM_SIZE] && !wait_for_key
+			&& !is_skipping_break && breakpoints->is_hit(*this)) {
+			stop = StopReason::BREAKPOINT;
+			is_skipping_break = true;
+			return done;
+		}
+		is_skipping_break = false;
+		is_watch_hit = false;
+		bool ok = profile || call_graph ? profiled_step() : execute<true>();
+		if (!ok) {
+			stop = StopReason::ILLEGAL;
+			return done;
+		}
+		if (is_watch_hit) {
+			stop = StopReason::WATCHPOINT;
+			return done + 1;
+		}
+	}
+	return steps;
+}
+
+bool Emulator::profiled_step()
+{
+	// Steps waiting for a key are spent on the LD Vx, K instruction, once
+	// the key is pressed a step executes the instruction after it.
+	bool is_idle = wait_for_key && key == C8_KEY_NONE;
+	uint16_t at = wait_for_key && !is_idle ? pc + C8_INS_LEN : pc;
+	auto type = is_idle ? Instruction::LD_v_K
+						: DecodedIns(fetch_ins(at)).type;
+
+	auto start = host_ticks();
+	bool ret = tracer || heatmap || breakpoints ? execute<true>()
+											   : execute<false>();
+	auto ticks = host_ticks() - start;
+	if (profile)
+		profile->add(at, type, ticks);
+	// Nothing is retired by idle and illegal steps
+	if (call_graph && !is_idle && ret)
+		call_graph->add(type, pc, ticks);
+	return ret;
+}
+
+template <bool IS_INSTRUMENTED>
+bool Emulator::execute()
 {
 	using I = Instruction;
-	std::chrono::duration<double> dt = steady_clock::now() - last_time;
-	last_time = steady_clock::now();
-	update_timers(dt.count());
+	double dt = step_time;
+	if (step_time == 0) {
+		auto now = steady_clock::now();
+		dt = std::chrono::duration<double>(now - last_time).count();
+		last_time = now;
+	}
+	update_timers(dt);
+	elapsed += dt;
 
 	if (wait_for_key) {
 		if (key != C8_KEY_NONE) {
@@ -63,8 +175,12 @@ bool Emulator::step()
 	// Wrap evey indexing variable around before accessing data from array
 	// to prevent out of bounds access
 	// Instructions are 2 bytes long(big-endian)
-	uint16_t bincode = fetch_ins(pc % C8_RAM_SIZE);
+	uint16_t at = pc;
+	uint16_t bincode = fetch_ins(pc);
 	DecodedIns ins(bincode);
+	if (IS_INSTRUMENTED && heatmap)
+		heatmap->execute(pc);
+	C8_COUNT(ins[static_cast<int>(ins.type)]);
 
 	// Reference to Values of registers
 	auto &vvx = regs[ins.vx];
@@ -72,6 +188,8 @@ bool Emulator::step()
 
 	switch (ins.type) {
 	case I::CLS:
+		C8_COUNT(clears);
+		stats.invalidations++;
 		std::fill(begin(screen), end(screen), 0);
 		break;
 
@@ -93,18 +211,15 @@ bool Emulator::step()
 		break;
 
 	case I::SE_v_b:
-		if (vvx == ins.byte)
-			pc += C8_INS_LEN;
+		skip_if(vvx == ins.byte);
 		break;
 
 	case I::SNE_v_b:
-		if (vvx != ins.byte)
-			pc += C8_INS_LEN;
+		skip_if(vvx != ins.byte);
 		break;
 
 	case I::SE_v_v:
-		if (vvx == vvy)
-			pc += C8_INS_LEN;
+		skip_if(vvx == vvy);
 		break;
 
 	case I::LD_v_b:
@@ -122,41 +237,48 @@ bool Emulator::step()
 
 	case I::OR_v_v:
 		vvx |= vvy;
+		if (quirks.logic_reset_vf)
+			regs[C8_FLAG_REG] = 0;
 		break;
 
 	case I::AND_v_v:
 		vvx &= vvy;
+		if (quirks.logic_reset_vf)
+			regs[C8_FLAG_REG] = 0;
 		break;
 
 	case I::XOR_v_v:
 		vvx ^= vvy;
+		if (quirks.logic_reset_vf)
+			regs[C8_FLAG_REG] = 0;
 		break;
 
 	case I::ADD_v_v:
-		vvx = add_with_ovf(vvx, vvy);
+		store_with_flag(vvx, vvx + vvy, vvx + vvy > 0xFF);
 		break;
 
 	case I::SUB_v_v:
-		vvx = add_with_ovf(vvx, ~vvy + 1);
+		store_with_flag(vvx, vvx - vvy, vvx >= vvy);
 		break;
 
 	case I::SHR_v:
-		regs[C8_FLAG_REG] = vvx & 1;
-		vvx >>= 1;
+		if (quirks.shift_vy)
+			vvx = vvy;
+		store_with_flag(vvx, vvx >> 1, vvx & 1);
 		break;
 
 	case I::SUBN_v_v:
-		vvx = add_with_ovf(vvy, ~vvx + 1);
+		store_with_flag(vvx, vvy - vvx, vvy >= vvx);
 		break;
 
 	case I::SHL_v:
-		regs[C8_FLAG_REG] = (vvx >> 7) & 1; // regs[x] is 8-bits
-		vvx <<= 1;
+		if (quirks.shift_vy)
+			vvx = vvy;
+		store_with_flag(vvx, vvx << 1, vvx >> 7); // regs[x] is 8-bits
 		break;
 
 	case I::SNE_v_v:
-		if (vvx != vvy)
-			pc += C8_INS_LEN;
+		skip_if(vvx != vvy);
 		break;
 
 	case I::LD_I_a:
@@ -164,7 +286,7 @@ bool Emulator::step()
 		break;
 
 	case I::JP_V0_a:
-		pc = regs[0] + ins.addr;
+		pc = regs[quirks.jump_vx ? ins.vx : 0] + ins.addr;
 		break;
 
 	case I::RND_v_b:
@@ -172,17 +294,17 @@ bool Emulator::step()
 		break;
 
 	case I::DRW_v_v_n:
+		if (IS_INSTRUMENTED && heatmap)
+			heatmap->read(index, ins.nibble);
 		draw_sprite(vvx, vvy, ins.nibble);
 		break;
 
 	case I::SKP_v:
-		if (key != C8_KEY_NONE && vvx == key)
-			pc += C8_INS_LEN;
+		skip_if(key != C8_KEY_NONE && vvx == key);
 		break;
 
 	case I::SKNP_v:
-		if (key == C8_KEY_NONE || vvx != key)
-			pc += C8_INS_LEN;
+		skip_if(key == C8_KEY_NONE || vvx != key);
 		break;
 
 	case I::LD_v_DT:
@@ -190,6 +312,7 @@ bool Emulator::step()
 		break;
 
 	case I::LD_v_K:
+		stats.key_waits++;
 		key_reg = ins.vx;
 		wait_for_key = true;
 		break;
@@ -211,6 +334,10 @@ bool Emulator::step()
 		break;
 
 	case I::LD_B_v:
+		if (IS_INSTRUMENTED && heatmap)
+			heatmap->write(index, 3);
+		if (IS_INSTRUMENTED && breakpoints)
+			watch_writes(index, 3);
 		// Instead of overflowing wrap around
 		ram[(index + 0) % C8_RAM_SIZE] = vvx / 100;
 		ram[(index + 1) % C8_RAM_SIZE] = (vvx % 100) / 10;
@@ -218,17 +345,28 @@ bool Emulator::step()
 		break;
 
 	case I::LD_IM_v:
+		if (IS_INSTRUMENTED && heatmap)
+			heatmap->write(index, ins.vx + 1);
+		if (IS_INSTRUMENTED && breakpoints)
+			watch_writes(index, ins.vx + 1);
 		for (unsigned i = 0; i <= ins.vx; ++i)
 			ram[(index + i) % C8_RAM_SIZE] = regs[i];
+		if (quirks.load_store_inc_i)
+			index += ins.vx + 1;
 		break;
 
 	case I::LD_v_IM:
+		if (IS_INSTRUMENTED && heatmap)
+			heatmap->read(index, ins.vx + 1);
 		for (unsigned i = 0; i <= ins.vx; ++i)
 			regs[i] = ram[(index + i) % C8_RAM_SIZE];
+		if (quirks.load_store_inc_i)
+			index += ins.vx + 1;
 		break;
 
 	case I::ILLEGAL:
-		return false;
+		// Stays at the instruction
+		stats.illegal++;
 		break;
 	}
 
@@ -241,6 +379,7 @@ bool Emulator::step()
 	case I::CALL_a:
 	case I::JP_V0_a:
 	case I::LD_v_K:
+	case I::ILLEGAL:
 		break;
 
 	default:
@@ -248,15 +387,36 @@ bool Emulator::step()
 		break;
 	}
 
-	return true;
+	if (IS_INSTRUMENTED && tracer) {
+		TraceRecord rec{
+			at, bincode, index, TRACE_NO_REG, 0, regs[C8_FLAG_REG], key
+		};
+		if (writes_vx(ins.type)) {
+			rec.reg = ins.vx;
+			rec.value = regs[ins.vx];
+		}
+		tracer->add(rec);
+	}
+	stats.retired += ins.type != I::ILLEGAL;
+	return ins.type != I::ILLEGAL;
 }
 
 void Emulator::draw_sprite(uint8_t x, uint8_t y, uint8_t height)
 {
 	bool collision = false;
-	for (unsigned i = 0; i != height; ++i) {
+	unsigned flipped = 0;
+	// The sprite starts on the screen, past that it wraps around or is cut
+	x %= C8_SCREEN_WIDTH;
+	y %= C8_SCREEN_HEIGHT;
+	unsigned rows = height;
+	unsigned cols = 8;
+	if (quirks.clip_sprites) {
+		rows = std::min<unsigned>(rows, C8_SCREEN_HEIGHT - y);
+		cols = std::min<unsigned>(cols, C8_SCREEN_WIDTH - x);
+	}
+	for (unsigned i = 0; i != rows; ++i) {
 		auto yf = (y + i) % C8_SCREEN_HEIGHT;
-		for (unsigned j = 0; j != 8; ++j) {
+		for (unsigned j = 0; j != cols; ++j) {
 			auto xf = (x + j) % C8_SCREEN_WIDTH;
 
 			// We XOR the current pixels with the sprite
@@ -264,6 +424,7 @@ void Emulator::draw_sprite(uint8_t x, uint8_t y, uint8_t height)
 			// MSB to LSB - Left to right
 			auto img_px = (ram[(index + i) % C8_RAM_SIZE] >> (7 - j)) & 1;
 			uint8_t new_px = screen[yf][xf] ^ img_px;
+			flipped += img_px;
 
 			if (screen[yf][xf] && !new_px)
 				collision = true;
@@ -271,9 +432,34 @@ void Emulator::draw_sprite(uint8_t x, uint8_t y, uint8_t height)
 		}
 	}
 
+	if (collision)
+		C8_COUNT(collisions);
+	stats.draws++;
+	stats.pixels_flipped += flipped;
+	stats.collisions += collision;
+	stats.invalidations += flipped != 0;
 	regs[C8_FLAG_REG] = collision;
 }
 
+void Emulator::watch_writes(uint16_t addr, unsigned n)
+{
+	for (unsigned i = 0; i < n && !is_watch_hit; ++i) {
+		uint16_t at = (addr + i) % C8_RAM_SIZE;
+		is_watch_hit = breakpoints->write[at];
+		watch_addr = at;
+	}
+}
+
+void Emulator::skip_if(bool cond)
+{
+	if (cond) {
+		C8_COUNT(skips_taken);
+		pc += C8_INS_LEN;
+	} else {
+		C8_COUNT(skips_not_taken);
+	}
+}
+
 void Emulator::update_timers(double dt)
 {
 	stimer -= dt * C8_TIMER_FREQ;
@@ -284,10 +470,9 @@ void Emulator::update_timers(double dt)
 		dtimer = 0;
 }
 
-uint8_t Emulator::add_with_ovf(uint8_t a, uint8_t b)
+void Emulator::store_with_flag(uint8_t &reg, uint8_t value, bool flag)
 {
-	// Usigned overflow is well-defined in C++
-	uint8_t s = a + b;
-	regs[C8_FLAG_REG] = s < a || s < b;
-	return s;
+	// VF is written last, so an instruction on VF leaves the flag there
+	reg = value;
+	regs[C8_FLAG_REG] = flag;
 }
@@ -4,27 +4,157 @@
 #include <cmath>
 #include <cstdint>
 #include <random>
+#include <string_view>
 #include <bitset>
 #include <chrono>
 
 #include "chip8.hxx"
+#include "counters.hxx"
 
 using std::uint16_t;
 using std::uint8_t;
 
+struct Breakpoints;
+struct Heatmap;
+struct Profile;
+class CallGraph;
+class TraceWriter;
+
+/// @brief Statistics of an emulator run, always kept, see
+/// Emulator::get_stats()
+struct Stats {
+	/// Instructions executed, not the steps waiting for a key
+	std::uint64_t retired = 0;
+	/// Ticks of the 60Hz timers, by the time the emulator was run for
+	std::uint64_t frames = 0;
+	/// DRW instructions and the pixels they flipped
+	std::uint64_t draws = 0;
+	std::uint64_t pixels_flipped = 0;
+	std::uint64_t collisions = 0;
+	/// LD Vx, K instructions, each waits for a key
+	std::uint64_t key_waits = 0;
+	/// Steps which found an illegal instruction
+	std::uint64_t illegal = 0;
+	/// Steps which changed the screen, each a redraw for a frontend
+	std::uint64_t invalidations = 0;
+	/// Host time spent in run()
+	double step_seconds = 0;
+};
+
+/// @brief Behaviours which differ between CHIP-8 interpreters. The defaults
+/// are what this emulator always did.
+struct Quirks {
+	/// SHR and SHL shift Vy into Vx, instead of shifting Vx
+	bool shift_vy = false;
+	/// LD [I], Vx and LD Vx, [I] leave I past the last register
+	bool load_store_inc_i = false;
+	/// OR, AND and XOR set VF to 0
+	bool logic_reset_vf = false;
+	/// Sprites are cut at the edges of the screen instead of wrapping around
+	bool clip_sprites = false;
+	/// JP V0, a jumps to a + Vx, x being the high nibble of a
+	bool jump_vx = false;
+};
+
+/// @brief Named sets of quirks, indexes QUIRK_PROFILES
+enum class QuirkProfile {
+	DEFAULT,
+	VIP,
+	SCHIP,
+};
+
+constexpr std::string_view QUIRK_PROFILE_NAMES[] = {"default", "vip", "schip"};
+
+/// @brief Quirks of each profile: this emulator's, the COSMAC VIP's and
+/// SUPER-CHIP's
+constexpr Quirks QUIRK_PROFILES[] = {
+	{},
+	{true, true, true, true, false},
+	{false, false, false, true, true},
+};
+
+/// @brief Why the last Emulator::run() stopped before doing all its steps
+enum class StopReason {
+	NONE,
+	ILLEGAL,
+	BREAKPOINT,
+	WATCHPOINT,
+};
+
 class Emulator
 {
 public:
 	Emulator(const uint8_t *rom_beg, const uint8_t *rom_end);
 	explicit operator bool() { return !error; }
+	/// @brief Start over with a ROM, like a new emulator but cheaper: the
+	/// random generator is not seeded again, the step time, the quirks and
+	/// what is attached(profile, tracer...) are kept.
+	/// @return false if the ROM does not fit
+	bool reset(const uint8_t *rom_beg, const uint8_t *rom_end);
 	bool step();
+	/// @brief Step up to steps times, stopping at an illegal instruction,
+	/// a breakpoint or a watchpoint, see stop_reason(). Times the steps into
+	/// the stats, which step() alone does not.
+	/// @return Steps done, not counting an illegal instruction
+	std::uint64_t run(std::uint64_t steps);
+	StopReason stop_reason() const { return stop; }
+	/// Address whose write stopped the last run() at a watchpoint
+	uint16_t watch_address() const { return watch_addr; }
 	/// Resets the internal clock used for timers
 	void reset_clock() { last_time = std::chrono::steady_clock::now(); }
+	/// Advance the timers by a fixed time on every step instead of by the
+	/// time passed, makes runs repeatable. 0 goes back to the real time.
+	void set_step_time(double seconds) { step_time = seconds; }
+	void set_quirks(const Quirks &q) { quirks = q; }
+	const Quirks &get_quirks() const { return quirks; }
+	/// Seed the random number generator, makes runs repeatable
+	void seed(unsigned s) { rand_gen.seed(s); }
+	/// Count every step into the profile, nullptr stops profiling.
+	/// The profile is not owned, it must outlive its use here.
+	void set_profile(Profile *p) { profile = p; }
+	/// Follow calls into the call graph, nullptr stops it. The call graph
+	/// is not owned, it must outlive its use here.
+	void set_call_graph(CallGraph *g) { call_graph = g; }
+	/// Count RAM accesses into the heatmap, nullptr stops it. The heatmap
+	/// is not owned, it must outlive its use here.
+	void set_heatmap(Heatmap *h) { heatmap = h; }
+	/// Record every instruction executed into the trace, nullptr stops
+	/// tracing. The writer is not owned, it must outlive its use here.
+	void set_tracer(TraceWriter *t) { tracer = t; }
+	/// Stop run() at the breakpoints and watchpoints, nullptr removes them.
+	/// Only run() checks them, in a loop of its own used while any are set.
+	/// They are not owned, they must outlive their use here.
+	void set_breakpoints(Breakpoints *b) { breakpoints = b; }
+	/// The next run() does not stop at a breakpoint at PC, so that it goes
+	/// on from there. run() does this itself when it stops at a breakpoint.
+	void skip_breakpoint() { is_skipping_break = true; }
+	/// Snapshot of the statistics so far
+	Stats get_stats() const
+	{
+		Stats ret = stats;
+		ret.frames = std::llround(elapsed * C8_TIMER_FREQ);
+		return ret;
+	}
+#ifdef C8_COUNTERS
+	const Counters &get_counters() const { return counters; }
+#endif
 	bool pixel(int x, int y) { return screen[y][x]; }
+	// Read only access to the rest of the state, for comparing emulators
+	const uint8_t *memory() const { return ram; }
+	const uint16_t *call_stack() const { return stack; }
+	const std::bitset<C8_SCREEN_WIDTH> &screen_row(int y) const
+	{
+		return screen[y];
+	}
+	bool is_waiting_for_key() const { return wait_for_key; }
 
 	uint8_t delay_timer() const { return std::lround(dtimer); }
 	uint8_t sound_timer() const { return std::lround(stimer); }
-	uint16_t fetch_ins(uint16_t n) const { return (ram[n] << 8) | ram[n + 1]; }
+	/// Instruction at an address, wrapping around the end of RAM
+	uint16_t fetch_ins(uint16_t n) const
+	{
+		return (ram[n % C8_RAM_SIZE] << 8) | ram[(n + 1) % C8_RAM_SIZE];
+	}
 
 	// Direct access is needed for displaying info
 	uint16_t pc = C8_PROG_START;
@@ -45,11 +175,41 @@ private:
 	std::bitset<C8_SCREEN_WIDTH> screen[C8_SCREEN_HEIGHT]{};
 	std::default_random_engine rand_gen;
 	std::chrono::steady_clock::time_point last_time;
+	double step_time = 0;
+	Quirks quirks;
+	// Seconds the timers were run for
+	double elapsed = 0;
+	Stats stats;
+	Profile *profile = nullptr;
+	CallGraph *call_graph = nullptr;
+	Heatmap *heatmap = nullptr;
+	TraceWriter *tracer = nullptr;
+	Breakpoints *breakpoints = nullptr;
+	StopReason stop = StopReason::NONE;
+	bool is_skipping_break = false;
+	bool is_watch_hit = false;
+	uint16_t watch_addr = 0;
+#ifdef C8_COUNTERS
+	Counters counters;
+#endif
 
+	/// Execute an instruction, recording it to the tracer and the heatmap
+	/// if IS_INSTRUMENTED
+	template <bool IS_INSTRUMENTED>
+	bool execute();
+	// Not inlined, so that step() without profiling does not pay for
+	// saving the registers it needs
+	[[gnu::noinline]] bool profiled_step();
+	/// run() while there are breakpoints, checking them on every step
+	[[gnu::noinline]] std::uint64_t run_checked(std::uint64_t steps);
+	/// Note a write to watched addresses among n from addr
+	void watch_writes(uint16_t addr, unsigned n);
+	/// Skip the next instruction if cond is true
+	void skip_if(bool cond);
 	void draw_sprite(uint8_t x, uint8_t y, uint8_t height);
 	void update_timers(double dt);
-	/// Add and set the overflow flag if unsigned overflow occurs
-	uint8_t add_with_ovf(uint8_t a, uint8_t b);
+	/// Store the result of an arithmetic instruction, then its flag in VF
+	void store_with_flag(uint8_t &reg, uint8_t value, bool flag);
 };
 
 #endif // END emulator.hxx
@@ -0,0 +1,367 @@
+// Headless emulator runner: runs a ROM for a number of steps without any
+// window, sound or keyboard, with a fixed timer step and random seed so
+// that runs are repeatable. Optionally profiles the run.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <string_view>
+
+#include "breakpoints.hxx"
+#include "chip8.hxx"
+#include "decoder.hxx"
+#include "emulator.hxx"
+#include "heatmap.hxx"
+#include "profile.hxx"
+#include "romdb.hxx"
+#include "trace.hxx"
+
+using std::clog;
+using std::string_view;
+using std::uint64_t;
+using std::uint8_t;
+
+/// @brief Options from the command line
+struct Options {
+	const char *rom = nullptr;
+	const char *profile = nullptr;
+	const char *listing = nullptr;
+	const char *trace = nullptr;
+	const char *symbols = nullptr;
+	const char *folded = nullptr;
+	const char *folded_drw = nullptr;
+	const char *heatmap = nullptr;
+	uint64_t steps = 10'000'000;
+	unsigned seed = 1;
+	// 0 takes them from the ROM database
+	unsigned ips = 0;
+	int quirks = -1;
+	bool is_identifying = false;
+	Breakpoints breakpoints;
+};
+
+static void print_usage(const char *name)
+{
+	clog << "Usage: " << name << " [options] <rom>\n"
+		 << "Options:\n"
+		 << "  -n <steps>        Steps to run (default: 10000000)\n"
+		 << "  --seed <n>        Seed of the random number generator\n"
+		 << "                    (default: 1)\n"
+		 << "  --ips <n>         Instructions per second, the timers count\n"
+		 << "                    down by 1/<n> seconds a step (default: the\n"
+		 << "                    ROM's in the database, else 300)\n"
+		 << "  --quirks <name>   Quirk profile: default, vip or schip\n"
+		 << "                    (default: the ROM's in the database)\n"
+		 << "  --id              Print the hash of the ROM and its entry in\n"
+		 << "                    the database, and exit\n"
+		 << "  --break <addr>    Stop before executing the instruction at\n"
+		 << "                    <addr>(hex), can be given more than once\n"
+		 << "  --break '<addr> if <condition>'\n"
+		 << "                    Stop there only if <condition> holds, as\n"
+		 << "                    in 'V3 == 0x10 && I > 0x300' or 'hits > 9'\n"
+		 << "  --watch <addr>    Stop after an instruction writes to <addr>\n"
+		 << "                    (hex), can be given more than once\n"
+		 << "  --profile <file>  Write a profile: hits for each address and\n"
+		 << "                    time for each instruction type\n"
+		 << "  --lst <file>      Annotate this listing(c8asm --lst) in the\n"
+		 << "                    profile instead of a disassembly\n"
+		 << "  --trace <file>    Record every instruction executed to a\n"
+		 << "                    trace, see c8trace\n"
+		 << "  --folded <file>   Write the instructions retired by each call\n"
+		 << "                    stack, as folded stacks for flame graphs\n"
+		 << "  --folded-drw <file>\n"
+		 << "                    Write the host cycles spent drawing by each\n"
+		 << "                    call stack, as folded stacks\n"
+		 << "  --sym <file>      Name functions in call stacks by the labels\n"
+		 << "                    of this symbol map(c8asm --sym)\n"
+		 << "  --heatmap <file>  Write the reads, writes and executions of\n"
+		 << "                    each RAM address\n";
+}
+
+static bool parse_options(int argc, char const **argv, Options &opts)
+{
+	for (int i = 1; i < argc; ++i) {
+		string_view arg = argv[i];
+		bool has_value = i + 1 < argc;
+		if (arg == "-n" && has_value) {
+			opts.steps = std::strtoull(argv[++i], nullptr, 10);
+		} else if (arg == "--seed" && has_value) {
+			opts.seed = std::strtoul(argv[++i], nullptr, 10);
+		} else if (arg == "--ips" && has_value) {
+			opts.ips = std::strtoul(argv[++i], nullptr, 10);
+			if (opts.ips == 0)
+				return false;
+		} else if (arg == "--quirks" && has_value) {
+			auto it = std::find(
+				std::begin(QUIRK_PROFILE_NAMES), std::end(QUIRK_PROFILE_NAMES),
+				argv[++i]
+			);
+			if (it == std::end(QUIRK_PROFILE_NAMES))
+				return false;
+			opts.quirks = it - std::begin(QUIRK_PROFILE_NAMES);
+		} else if (arg == "--id") {
+			opts.is_identifying = true;
+		} else if (arg == "--break" && has_value) {
+			std::string error;
+			if (!opts.breakpoints.add(argv[++i], error)) {
+				clog << "Breakpoint '" << argv[i] << "': " << error << '\n';
+				return false;
+			}
+		} else if (arg == "--watch" && has_value) {
+			auto addr = parse_address(argv[++i]);
+			if (!addr)
+				return false;
+			opts.breakpoints.write.set(*addr);
+		} else if (arg == "--profile" && has_value) {
+			opts.profile = argv[++i];
+		} else if (arg == "--lst" && has_value) {
+			opts.listing = argv[++i];
+		} else if (arg == "--trace" && has_value) {
+			opts.trace = argv[++i];
+		} else if (arg == "--folded" && has_value) {
+			opts.folded = argv[++i];
+		} else if (arg == "--folded-drw" && has_value) {
+			opts.folded_drw = argv[++i];
+		} else if (arg == "--heatmap" && has_value) {
+			opts.heatmap = argv[++i];
+		} else if (arg == "--sym" && has_value) {
+			opts.symbols = argv[++i];
+		} else if (!opts.rom && !arg.empty() && arg[0] != '-') {
+			opts.rom = argv[i];
+		} else {
+			return false;
+		}
+	}
+	return opts.rom;
+}
+
+/// @brief Print the hash of a ROM and its database entry, or an entry to
+/// add for it
+static void print_rom_info(uint64_t hash, const RomInfo *info)
+{
+	std::printf("Hash: %016llX\n", (unsigned long long)hash);
+	if (!info) {
+		std::printf(
+			"Not in the database, its entry would be:\n"
+			"\t{0x%016llX, \"<title>\", QuirkProfile::DEFAULT, %u,\n"
+			"\t {NO_KEY, NO_KEY, NO_KEY, NO_KEY}},\n",
+			(unsigned long long)hash, DEFAULT_IPS
+		);
+		return;
+	}
+	auto quirks = QUIRK_PROFILE_NAMES[static_cast<int>(info->quirks)];
+	std::printf(
+		"Title: %s\nQuirks: %.*s\nSpeed: %u instructions/s\nKeys:",
+		info->title, int(quirks.size()), quirks.data(), info->ips
+	);
+	const char *directions[] = {"up", "left", "down", "right"};
+	bool has_keys = false;
+	for (int i = 0; i < 4; ++i) {
+		if (info->dpad[i] == C8_KEY_NONE)
+			continue;
+		std::printf(" %s=%X", directions[i], info->dpad[i]);
+		has_keys = true;
+	}
+	std::printf(has_keys ? "\n" : " default\n");
+}
+
+static void print_state(const Emulator &emu)
+{
+	std::printf(
+		"PC=%04X I=%04X SP=%u DT=%u ST=%u\n", emu.pc, emu.index, emu.sp,
+		emu.delay_timer(), emu.sound_timer()
+	);
+	for (int i = 0; i < C8_REG_CNT; ++i)
+		std::printf(
+			"V%X=%02X%c", i, emu.regs[i], i + 1 == C8_REG_CNT ? '\n' : ' '
+		);
+}
+
+static void print_stats(const Stats &stats)
+{
+	std::printf(
+		"Retired: %llu, frames: %llu, stepping: %.3f ms\n"
+		"Draws: %llu, pixels flipped: %llu, collisions: %llu, "
+		"invalidations: %llu\n"
+		"Key waits: %llu, illegal: %llu\n",
+		(unsigned long long)stats.retired, (unsigned long long)stats.frames,
+		stats.step_seconds * 1e3, (unsigned long long)stats.draws,
+		(unsigned long long)stats.pixels_flipped,
+		(unsigned long long)stats.collisions,
+		(unsigned long long)stats.invalidations,
+		(unsigned long long)stats.key_waits, (unsigned long long)stats.illegal
+	);
+}
+
+#ifdef C8_COUNTERS
+static void print_counters(const Counters &counters)
+{
+	std::printf("Instructions:\n");
+	for (int i = 0; i < INSTRUCTION_CNT; ++i) {
+		if (counters.ins[i] != 0)
+			std::printf(
+				"%12llu  %s\n", (unsigned long long)counters.ins[i],
+				std::string(ins_format(Instruction(i))).c_str()
+			);
+	}
+	std::printf(
+		"Skips taken: %llu, not taken: %llu\nCollisions: %llu\nClears: %llu\n",
+		(unsigned long long)counters.skips_taken,
+		(unsigned long long)counters.skips_not_taken,
+		(unsigned long long)counters.collisions,
+		(unsigned long long)counters.clears
+	);
+}
+#endif
+
+int main(int argc, char const **argv)
+{
+	Options opts;
+	if (!parse_options(argc, argv, opts)) {
+		print_usage(argc > 0 ? argv[0] : "c8run");
+		return 1;
+	}
+
+	std::ifstream rom_file(opts.rom, std::ios::binary);
+	if (!rom_file) {
+		clog << "Cannot open file '" << opts.rom << "'\n";
+		return 1;
+	}
+	// Only read upto 4K, the emulator rejects what does not fit its RAM
+	uint8_t rom[C8_RAM_SIZE]{};
+	rom_file.read(reinterpret_cast<char *>(rom), sizeof(rom));
+	auto rom_size = static_cast<unsigned>(rom_file.gcount());
+
+	auto hash = rom_hash(rom, rom + rom_size);
+	auto info = find_rom(hash);
+	if (opts.is_identifying) {
+		print_rom_info(hash, info);
+		return 0;
+	}
+	auto quirks = opts.quirks >= 0 ? QuirkProfile(opts.quirks)
+				  : info             ? info->quirks
+									 : QuirkProfile::DEFAULT;
+	auto ips = opts.ips ? opts.ips : info ? info->ips : DEFAULT_IPS;
+
+	Emulator emu(rom, rom + rom_size);
+	if (!emu) {
+		clog << "Cannot initialize emulator.\n";
+		return 1;
+	}
+	emu.seed(opts.seed);
+	emu.set_step_time(1.0 / ips);
+	emu.set_quirks(QUIRK_PROFILES[static_cast<int>(quirks)]);
+	emu.set_breakpoints(&opts.breakpoints);
+
+	std::unique_ptr<Profile> profile;
+	if (opts.profile) {
+		profile = std::make_unique<Profile>();
+		emu.set_profile(profile.get());
+	}
+	std::unique_ptr<CallGraph> call_graph;
+	if (opts.folded || opts.folded_drw) {
+		call_graph = std::make_unique<CallGraph>();
+		if (opts.symbols) {
+			std::ifstream sym_file(opts.symbols);
+			if (!sym_file) {
+				clog << "Cannot open file '" << opts.symbols << "'\n";
+				return 1;
+			}
+			call_graph->load_symbols(sym_file);
+		}
+		emu.set_call_graph(call_graph.get());
+	}
+	std::unique_ptr<Heatmap> heatmap;
+	if (opts.heatmap) {
+		heatmap = std::make_unique<Heatmap>();
+		emu.set_heatmap(heatmap.get());
+	}
+	std::unique_ptr<TraceWriter> tracer;
+	if (opts.trace) {
+		tracer = std::make_unique<TraceWriter>(opts.trace);
+		if (!*tracer) {
+			clog << "Cannot open file '" << opts.trace << "'\n";
+			return 1;
+		}
+		emu.set_tracer(tracer.get());
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	uint64_t step = emu.run(opts.steps);
+	bool is_illegal = emu.stop_reason() == StopReason::ILLEGAL;
+	// Trace writing is part of the time taken
+	if (tracer && !tracer->close()) {
+		clog << "Cannot write file '" << opts.trace << "'\n";
+		return 1;
+	}
+	std::chrono::duration<double> took =
+		std::chrono::steady_clock::now() - start;
+
+	std::printf(
+		"Ran %llu steps in %.3f ms (%.0f steps/s)\n", (unsigned long long)step,
+		took.count() * 1e3, took.count() > 0 ? step / took.count() : 0.0
+	);
+	if (emu.stop_reason() == StopReason::BREAKPOINT)
+		std::printf(
+			"Stopped at a breakpoint, reached %llu times\n",
+			(unsigned long long)opts.breakpoints.hits[emu.pc % C8_RAM_SIZE]
+		);
+	else if (emu.stop_reason() == StopReason::WATCHPOINT)
+		std::printf("Stopped after a write to %03X\n", emu.watch_address());
+	print_state(emu);
+	print_stats(emu.get_stats());
+#ifdef C8_COUNTERS
+	print_counters(emu.get_counters());
+#endif
+	if (is_illegal)
+		clog << "Illegal instruction at 0x" << std::hex << emu.pc << std::dec
+			 << '\n';
+
+	if (profile) {
+		std::ofstream prof_file(opts.profile);
+		if (!prof_file) {
+			clog << "Cannot open file '" << opts.profile << "'\n";
+			return 1;
+		}
+		std::ifstream lst_file;
+		if (opts.listing) {
+			lst_file.open(opts.listing);
+			if (!lst_file) {
+				clog << "Cannot open file '" << opts.listing << "'\n";
+				return 1;
+			}
+		}
+		write_profile(
+			prof_file, *profile, emu, rom_size, opts.listing ? &lst_file : nullptr
+		);
+	}
+
+	if (heatmap && !heatmap->save(opts.heatmap)) {
+		clog << "Cannot write file '" << opts.heatmap << "'\n";
+		return 1;
+	}
+
+	using Weight = CallGraph::Weight;
+	for (auto [path, weight] :
+		 {std::pair(opts.folded, Weight::RETIRED),
+		  std::pair(opts.folded_drw, Weight::DRW_TICKS)}) {
+		if (!path)
+			continue;
+		std::ofstream folded_file(path);
+		if (!folded_file) {
+			clog << "Cannot open file '" << path << "'\n";
+			return 1;
+		}
+		call_graph->write_folded(folded_file, weight);
+	}
+
+	return is_illegal ? 1 : 0;
+}
@@ -0,0 +1,16 @@
+#include <cstdio>
+
+#include "heatmap.hxx"
+
+bool Heatmap::save(const char *path) const
+{
+	auto file = std::fopen(path, "wb");
+	if (!file)
+		return false;
+
+	HeatmapHeader header;
+	bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+	for (auto counters : {reads, writes, executes})
+		ok = ok && std::fwrite(counters, sizeof(reads), 1, file) == 1;
+	return std::fclose(file) == 0 && ok;
+}
@@ -0,0 +1,46 @@
+#ifndef CHIP8_HEATMAP_HXX_INCLUDED
+#define CHIP8_HEATMAP_HXX_INCLUDED
+
+#include <cstdint>
+
+#include "chip8.hxx"
+
+/// @brief Reads, writes and executions of each RAM address, see
+/// Emulator::set_heatmap(). Both bytes of an instruction are executed.
+/// Drawing a sprite reads its bytes, LD [I], Vx and LD B, Vx write and
+/// LD Vx, [I] reads, wrapping around the end of RAM like they do.
+struct Heatmap {
+	std::uint64_t reads[C8_RAM_SIZE]{};
+	std::uint64_t writes[C8_RAM_SIZE]{};
+	std::uint64_t executes[C8_RAM_SIZE]{};
+
+	void read(unsigned addr, unsigned n)
+	{
+		for (unsigned i = 0; i < n; ++i)
+			reads[(addr + i) % C8_RAM_SIZE]++;
+	}
+	void write(unsigned addr, unsigned n)
+	{
+		for (unsigned i = 0; i < n; ++i)
+			writes[(addr + i) % C8_RAM_SIZE]++;
+	}
+	void execute(unsigned addr)
+	{
+		executes[addr % C8_RAM_SIZE]++;
+		executes[(addr + 1) % C8_RAM_SIZE]++;
+	}
+
+	/// @brief Write to a file: a HeatmapHeader, then the reads, writes and
+	/// executes arrays, counters in the byte order of the host
+	/// @return false if the file cannot be written
+	bool save(const char *path) const;
+};
+
+struct HeatmapHeader {
+	char magic[4] = {'C', '8', 'H', 'M'};
+	std::uint16_t version = 1;
+	std::uint16_t counter_size = sizeof(std::uint64_t);
+	std::uint32_t addr_cnt = C8_RAM_SIZE;
+};
+
+#endif // END heatmap.hxx
@@ -0,0 +1,254 @@
+// Lockstep differential runner: runs the emulator and the reference model
+// over the same ROM and key presses and compares their whole state after
+// every step or block of steps, to prove them equivalent.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "chip8.hxx"
+#include "decoder.hxx"
+#include "emulator.hxx"
+#include "reference.hxx"
+
+using std::clog;
+using std::string;
+using std::string_view;
+using std::uint16_t;
+using std::uint64_t;
+using std::uint8_t;
+
+/// Instructions shown before a mismatch
+constexpr unsigned CONTEXT_INS = 8;
+/// Differing RAM addresses listed at most
+constexpr unsigned MAX_RAM_DIFFS = 8;
+
+/// @brief Options from the command line
+struct Options {
+	const char *rom = nullptr;
+	uint64_t steps = 10'000'000;
+	uint64_t block = 1;
+	unsigned seed = 1;
+	unsigned ips = 300;
+	bool has_keys = false;
+	unsigned key_seed = 0;
+	uint64_t key_steps = 1000;
+};
+
+/// @brief The two engines and what they are fed
+struct Pair {
+	Pair(const uint8_t *rom_beg, const uint8_t *rom_end, const Options &opts)
+		: emu(rom_beg, rom_end)
+		, ref(rom_beg, rom_end)
+		, key_gen(opts.key_seed)
+	{
+		emu.seed(opts.seed);
+		ref.seed(opts.seed);
+		emu.set_step_time(1.0 / opts.ips);
+		ref.set_step_time(1.0 / opts.ips);
+	}
+
+	Emulator emu;
+	Reference ref;
+	// Keys held, a new one(or none) every key_steps
+	std::mt19937 key_gen;
+	// Address and opcode of the last steps, a ring buffer
+	uint16_t last_pc[CONTEXT_INS]{};
+	uint16_t last_op[CONTEXT_INS]{};
+};
+
+static void print_usage(const char *name)
+{
+	clog << "Usage: " << name << " [options] <rom>\n"
+		 << "  Run the emulator and the reference model in lockstep and\n"
+		 << "  report the first step after which their states differ. Exits\n"
+		 << "  with 0 if they never do, 1 if they do and 2 on errors\n"
+		 << "Options:\n"
+		 << "  -n <steps>        Steps to run (default: 10000000)\n"
+		 << "  -b <steps>        Compare every <steps> steps, a differing\n"
+		 << "                    block is replayed step by step (default: 1)\n"
+		 << "  --seed <n>        Seed of the random number generator\n"
+		 << "                    (default: 1)\n"
+		 << "  --ips <n>         Instructions per second, the timers count\n"
+		 << "                    down by 1/<n> seconds a step (default: 300)\n"
+		 << "  --keys <seed>     Press random keys, or none, seeded by <seed>\n"
+		 << "                    (default: no key is ever pressed)\n"
+		 << "  --key-steps <n>   Steps each key is held for (default: 1000)\n";
+}
+
+static bool parse_options(int argc, char const **argv, Options &opts)
+{
+	for (int i = 1; i < argc; ++i) {
+		string_view arg = argv[i];
+		bool has_value = i + 1 < argc;
+		if (arg == "-n" && has_value) {
+			opts.steps = std::strtoull(argv[++i], nullptr, 10);
+		} else if (arg == "-b" && has_value) {
+			opts.block = std::strtoull(argv[++i], nullptr, 10);
+		} else if (arg == "--seed" && has_value) {
+			opts.seed = std::strtoul(argv[++i], nullptr, 10);
+		} else if (arg == "--ips" && has_value) {
+			opts.ips = std::strtoul(argv[++i], nullptr, 10);
+		} else if (arg == "--keys" && has_value) {
+			opts.has_keys = true;
+			opts.key_seed = std::strtoul(argv[++i], nullptr, 10);
+		} else if (arg == "--key-steps" && has_value) {
+			opts.key_steps = std::strtoull(argv[++i], nullptr, 10);
+		} else if (!opts.rom && !arg.empty() && arg[0] != '-') {
+			opts.rom = argv[i];
+		} else {
+			return false;
+		}
+	}
+	return opts.rom && opts.ips != 0 && opts.block != 0 && opts.key_steps != 0;
+}
+
+/// @brief Step both once
+/// @return false if their steps did not return the same
+static bool step(Pair &pair, const Options &opts, uint64_t step_num, bool &is_illegal)
+{
+	if (opts.has_keys && step_num % opts.key_steps == 0) {
+		// Half of the time no key is held
+		auto key = pair.key_gen() % (2 * C8_KEY_CNT);
+		pair.emu.key = pair.ref.key = key < C8_KEY_CNT ? key : unsigned(C8_KEY_NONE);
+	}
+	auto mem = pair.emu.memory();
+	auto pc = pair.emu.pc;
+	pair.last_pc[step_num % CONTEXT_INS] = pc;
+	pair.last_op[step_num % CONTEXT_INS] =
+		mem[pc % C8_RAM_SIZE] << 8 | mem[(pc + 1) % C8_RAM_SIZE];
+
+	bool emu_ok = pair.emu.step();
+	bool ref_ok = pair.ref.step();
+	is_illegal = !emu_ok;
+	return emu_ok == ref_ok;
+}
+
+static void print_mismatch(const Pair &pair, uint64_t steps, string_view fields)
+{
+	auto &emu = pair.emu;
+	auto &ref = pair.ref;
+	std::printf(
+		"States differ after step %llu in: %.*s\n", (unsigned long long)steps,
+		int(fields.size()), fields.data()
+	);
+
+	std::printf("\nLast instructions:\n");
+	auto first = steps > CONTEXT_INS ? steps - CONTEXT_INS : 0;
+	for (auto i = first; i < steps; ++i) {
+		auto op = pair.last_op[i % CONTEXT_INS];
+		std::printf(
+			"%c %10llu  %04X  %04X  %s\n", i + 1 == steps ? '>' : ' ',
+			(unsigned long long)(i + 1), pair.last_pc[i % CONTEXT_INS], op,
+			DecodedIns(op).to_string().c_str()
+		);
+	}
+
+	std::printf("\n%-8s %9s %9s\n", "", "emulator", "reference");
+	auto row = [](const char *name, unsigned a, unsigned b) {
+		std::printf("%c %-6s %9X %9X\n", a != b ? '*' : ' ', name, a, b);
+	};
+	row("PC", emu.pc, ref.pc);
+	row("I", emu.index, ref.index);
+	row("SP", emu.sp, ref.sp);
+	row("DT", emu.delay_timer(), ref.delay_timer());
+	row("ST", emu.sound_timer(), ref.sound_timer());
+	row("Wait", emu.is_waiting_for_key(), ref.wait_for_key);
+	for (int i = 0; i < C8_REG_CNT; ++i)
+		row(REGISTERS[i].data(), emu.regs[i], ref.regs[i]);
+	for (int i = 0; i < C8_STACK_SIZE; ++i) {
+		if (emu.call_stack()[i] != ref.stack[i])
+			std::printf(
+				"* Stack%-2d %8X %9X\n", i, emu.call_stack()[i], ref.stack[i]
+			);
+	}
+	unsigned ram_diffs = 0;
+	for (int i = 0; i < C8_RAM_SIZE; ++i) {
+		if (emu.memory()[i] == ref.ram[i])
+			continue;
+		if (ram_diffs++ < MAX_RAM_DIFFS)
+			std::printf("* [%03X]  %9X %9X\n", i, emu.memory()[i], ref.ram[i]);
+	}
+	if (ram_diffs > MAX_RAM_DIFFS)
+		std::printf("  ... %u RAM bytes differ\n", ram_diffs);
+	for (int y = 0; y < C8_SCREEN_HEIGHT; ++y) {
+		auto emu_row = emu.screen_row(y).to_ullong();
+		if (emu_row != ref.screen[y])
+			std::printf(
+				"* Row %-2d %016llX %016llX\n", y, (unsigned long long)emu_row,
+				(unsigned long long)ref.screen[y]
+			);
+	}
+}
+
+/// @brief Run both from the start, comparing every opts.block steps
+/// @param[out] steps Steps run, up to the one after which they differ
+/// @return The differing parts of the state, empty if none
+static string run(
+	const uint8_t *rom_beg, const uint8_t *rom_end, const Options &opts,
+	uint64_t max_steps, uint64_t &steps, bool &is_illegal
+)
+{
+	Pair pair(rom_beg, rom_end, opts);
+	is_illegal = false;
+	for (steps = 0; steps < max_steps && !is_illegal;) {
+		bool is_same_step = step(pair, opts, steps, is_illegal);
+		steps++;
+		bool is_block_end =
+			steps % opts.block == 0 || steps == max_steps || is_illegal;
+		string fields = is_same_step ? "" : "illegal instruction";
+		if (is_same_step && is_block_end)
+			fields = differing_state(pair.emu, pair.ref);
+		if (fields.empty())
+			continue;
+
+		// Find the step in the block by replaying it one by one
+		if (opts.block != 1 && is_same_step) {
+			Options by_step = opts;
+			by_step.block = 1;
+			return run(rom_beg, rom_end, by_step, steps, steps, is_illegal);
+		}
+		print_mismatch(pair, steps, fields);
+		return fields;
+	}
+	return "";
+}
+
+int main(int argc, char const **argv)
+{
+	Options opts;
+	if (!parse_options(argc, argv, opts)) {
+		print_usage(argc > 0 ? argv[0] : "c8lockstep");
+		return 2;
+	}
+
+	std::ifstream rom_file(opts.rom, std::ios::binary);
+	if (!rom_file) {
+		clog << "Cannot open file '" << opts.rom << "'\n";
+		return 2;
+	}
+	uint8_t rom[C8_RAM_SIZE]{};
+	rom_file.read(reinterpret_cast<char *>(rom), sizeof(rom));
+	auto rom_end = rom + rom_file.gcount();
+	if (!Emulator(rom, rom_end)) {
+		clog << "Cannot initialize emulator.\n";
+		return 2;
+	}
+
+	uint64_t steps = 0;
+	bool is_illegal = false;
+	auto fields = run(rom, rom_end, opts, opts.steps, steps, is_illegal);
+	if (!fields.empty())
+		return 1;
+
+	std::printf("States are the same for %llu steps", (unsigned long long)steps);
+	if (is_illegal)
+		std::printf(", both stopped at an illegal instruction");
+	std::printf("\n");
+	return 0;
+}
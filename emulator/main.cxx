@@ -1,15 +1,22 @@
 #include <cstdint>
 #include <cmath>
+#include <cstdio>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <utility>
 
 #include "raylib/raylib.h"
 #include "raylib/raymath.h"
+#include "breakpoints.hxx"
 #include "decoder.hxx"
 #include "emulator.hxx"
+#include "heatmap.hxx"
+#include "romdb.hxx"
 #include "chip8.hxx"
 #include "space_mono.bin.h"
 
@@ -17,6 +24,7 @@ using std::clog;
 using std::int16_t;
 using std::string;
 using std::to_string;
+using std::uint64_t;
 using std::uint8_t;
 using std::vector;
 
@@ -57,6 +65,10 @@ enum UiConfig {
 	// Block sizes for elements
 	PIXEL_BLOCK_SIZE = 10,
 	KEY_BLOCK_SIZE = 80,
+	// RAM heatmap, in place of the screen: 64x64 addresses of 10x5px
+	HEATMAP_COLUMNS = 64,
+	HEATMAP_BLOCK_W = 10,
+	HEATMAP_BLOCK_H = 5,
 	// Gap of (3/4 * font_size) looks fine
 	FONT_LINE_HEIGHT = 3 * FONT_SIZE / 4,
 };
@@ -84,25 +96,28 @@ Original C8 keys     Mapped to keys
 struct C8Key {
 	int c8_keycode;
 	const char *c8_key_name;
-	const char *key_name;
 };
 
-// Map C8-key characters to keyboard characters. Since these are in their
-// layout order, we also store the c8-keycode for identifying keys.
+// C8-key characters in their layout order, we also store the c8-keycode
+// for identifying keys. The keyboard keys are named by the key map.
 constexpr C8Key C8_KEY_NAME_MAP[C8_KEY_CNT] = {
-	{0x1, "1", "1"}, {0x2, "2", "2"}, {0x3, "3", "3"}, {0xc, "C", "4"}, // Row 1
-	{0x4, "4", "Q"}, {0x5, "5", "W"}, {0x6, "6", "E"}, {0xd, "D", "R"}, // Row 2
-	{0x7, "7", "A"}, {0x8, "8", "S"}, {0x9, "9", "D"}, {0xe, "E", "F"}, // Row 3
-	{0xa, "A", "Z"}, {0x0, "0", "X"}, {0xb, "B", "C"}, {0xf, "F", "V"}, // Row 4
+	{0x1, "1"}, {0x2, "2"}, {0x3, "3"}, {0xc, "C"}, // Row 1
+	{0x4, "4"}, {0x5, "5"}, {0x6, "6"}, {0xd, "D"}, // Row 2
+	{0x7, "7"}, {0x8, "8"}, {0x9, "9"}, {0xe, "E"}, // Row 3
+	{0xa, "A"}, {0x0, "0"}, {0xb, "B"}, {0xf, "F"}, // Row 4
 
 };
 
 // C8-keycodes to keyboard keys mapping, indexed by C8 keys in order: 0 to F.
+// Raylib's codes of these keys are their characters.
 constexpr int C8_KEY_MAP[C8_KEY_CNT] = {
 	KEY_X, KEY_ONE, KEY_TWO, KEY_THREE, KEY_Q,    KEY_W, KEY_E, KEY_A,
 	KEY_S, KEY_D,   KEY_Z,   KEY_C,     KEY_FOUR, KEY_R, KEY_F, KEY_V,
 };
 
+// Keyboard keys for the directions of a ROM: up, left, down and right.
+constexpr int DPAD_KEY_MAP[] = {KEY_W, KEY_A, KEY_S, KEY_D};
+
 enum AudioConfig {
 	SAMPLE_RATE = 48000,
 	SAMPLE_SIZE = 16,
@@ -136,6 +151,72 @@ static void fmt_registers(const Emulator &emu, vector<string> &reg_txts)
 		reg_txts.push_back(fmt_reg(name, val));
 }
 
+/// @brief Short form of a count, fits the info box: 1234, 12.3K, 4.56M
+static string fmt_count(uint64_t n)
+{
+	const char *suffixes[] = {"", "K", "M", "G", "T"};
+	double val = double(n);
+	unsigned i = 0;
+	for (; val >= 10000 && i + 1 < ARRAY_SIZE(suffixes); ++i)
+		val /= 1000;
+	char buf[16];
+	if (i == 0)
+		std::snprintf(buf, sizeof(buf), "%llu", (unsigned long long)n);
+	else
+		std::snprintf(buf, sizeof(buf), "%.3g%s", val, suffixes[i]);
+	return buf;
+}
+
+static void fmt_stats(const Stats &stats, vector<string> &stat_txts)
+{
+	const std::pair<const char *, uint64_t> STAT_VALS[] = {
+		{"Retired ", stats.retired},
+		{"Frames  ", stats.frames},
+		{"Draws   ", stats.draws},
+		{"Flipped ", stats.pixels_flipped},
+		{"Collided", stats.collisions},
+		{"Key wait", stats.key_waits},
+		{"Illegal ", stats.illegal},
+		{"Invalid ", stats.invalidations},
+	};
+
+	stat_txts.clear();
+	for (auto [name, val] : STAT_VALS)
+		stat_txts.push_back(string(name) + " " + fmt_count(val));
+	auto ms = static_cast<uint64_t>(stats.step_seconds * 1e3);
+	stat_txts.push_back("Stepping " + fmt_count(ms) + "ms");
+}
+
+/// @brief Draw the RAM heatmap over the screen: writes in red, reads in
+/// green and executions in blue, brighter for more on a log scale.
+static void draw_heatmap(const Heatmap &heatmap)
+{
+	const uint64_t *counters[] = {
+		heatmap.writes, heatmap.reads, heatmap.executes
+	};
+	double log_max[3]{};
+	for (int c = 0; c < 3; ++c) {
+		uint64_t max = 0;
+		for (int i = 0; i < C8_RAM_SIZE; ++i)
+			max = std::max(max, counters[c][i]);
+		log_max[c] = std::log1p(double(max));
+	}
+
+	for (int i = 0; i < C8_RAM_SIZE; ++i) {
+		unsigned char rgb[3]{};
+		for (int c = 0; c < 3; ++c) {
+			if (counters[c][i] != 0)
+				rgb[c] = static_cast<unsigned char>(
+					55 + 200 * std::log1p(double(counters[c][i])) / log_max[c]
+				);
+		}
+		Color color = {rgb[0], rgb[1], rgb[2], 255};
+		int x = HEATMAP_BLOCK_W * (i % HEATMAP_COLUMNS);
+		int y = HEATMAP_BLOCK_H * (i / HEATMAP_COLUMNS);
+		DrawRectangle(x, y, HEATMAP_BLOCK_W, HEATMAP_BLOCK_H, color);
+	}
+}
+
 static void fill_audio_buffer_cb(void *raw_data, unsigned frames)
 {
 	static double t = 0.0;
@@ -152,16 +233,56 @@ static void fill_audio_buffer_cb(void *raw_data, unsigned frames)
 	}
 }
 
+/// @brief Put the keys of a ROM's directions on W, A, S and D, the keys
+/// which were there go where the direction keys were.
+static void map_dpad(const RomInfo &info, int key_map[C8_KEY_CNT])
+{
+	for (int i = 0; i < 4; ++i) {
+		if (info.dpad[i] == C8_KEY_NONE)
+			continue;
+		auto other = std::find(key_map, key_map + C8_KEY_CNT, DPAD_KEY_MAP[i]);
+		std::swap(*other, key_map[info.dpad[i]]);
+	}
+}
+
 int main(int argc, char const **argv)
 {
-	if (argc != 2) {
+	// Breakpoints and watchpoints from the command line, more breakpoints
+	// can be toggled while running
+	Breakpoints breakpoints;
+	const char *rom_path = nullptr;
+	bool is_usage_ok = true;
+	for (int i = 1; i < argc && is_usage_ok; ++i) {
+		std::string_view arg = argv[i];
+		if (arg == "--break" && i + 1 < argc) {
+			std::string error;
+			is_usage_ok = breakpoints.add(argv[++i], error);
+			if (!is_usage_ok)
+				clog << "Breakpoint '" << argv[i] << "': " << error << '\n';
+		} else if (arg == "--watch" && i + 1 < argc) {
+			auto addr = parse_address(argv[++i]);
+			is_usage_ok = addr.has_value();
+			if (addr)
+				breakpoints.write.set(*addr);
+		} else if (!rom_path && !arg.empty() && arg[0] != '-') {
+			rom_path = argv[i];
+		} else {
+			is_usage_ok = false;
+		}
+	}
+	if (!is_usage_ok || !rom_path) {
 		auto name = argc > 0 ? argv[0] : "c8asm";
-		clog << "Usage: " << name << " <rom-filename>\n";
+		clog << "Usage: " << name
+			 << " [--break '<addr> [if <condition>]']... [--watch <addr>]..."
+			 << " <rom-filename>\n"
+			 << "Addresses are in hex, execution stops before the instruction\n"
+			 << "at a breakpoint and after one writing to a watched address.\n"
+			 << "Conditions are like 'V3 == 0x10 && I > 0x300' or 'hits > 9'.\n";
 		return 1;
 	}
-	std::ifstream rom_file(argv[1], std::ios::binary);
+	std::ifstream rom_file(rom_path, std::ios::binary);
 	if (!rom_file) {
-		clog << "Cannot open file '" << argv[1] << "'\n";
+		clog << "Cannot open file '" << rom_path << "'\n";
 		return 1;
 	}
 
@@ -174,6 +295,22 @@ int main(int argc, char const **argv)
 		clog << "Cannot initialize emulator.\n";
 		return 1;
 	}
+	// Counted only while shown, it slows every step down
+	auto heatmap = std::make_unique<Heatmap>();
+	emu.set_breakpoints(&breakpoints);
+
+	// Known ROMs get their quirks, speed and keys from the database
+	int key_map[C8_KEY_CNT];
+	std::copy(std::begin(C8_KEY_MAP), std::end(C8_KEY_MAP), key_map);
+	auto rom_info = find_rom(rom_hash(rom, rom + bin_size));
+	auto quirks = rom_info ? rom_info->quirks : QuirkProfile::DEFAULT;
+	emu.set_quirks(QUIRK_PROFILES[static_cast<int>(quirks)]);
+	unsigned ips = rom_info ? rom_info->ips : DEFAULT_IPS;
+	if (rom_info)
+		map_dpad(*rom_info, key_map);
+	string title = "Chip-8 emulator";
+	if (rom_info)
+		title = title + " - " + rom_info->title;
 
 	// Initialization:
 	// Initialize Raylib, configure it and load resources.
@@ -181,7 +318,7 @@ int main(int argc, char const **argv)
 	InitAudioDevice();
 	SetTraceLogLevel(LOG_WARNING);
 	SetConfigFlags(FLAG_MSAA_4X_HINT);
-	InitWindow(SCREEN_W, SCREEN_H, "Chip-8 emulator");
+	InitWindow(SCREEN_W, SCREEN_H, title.c_str());
 	SetTargetFPS(60);
 
 	// 48kHz, 16-bit, mono-audio. Generate audio when requested.
@@ -206,14 +343,43 @@ int main(int argc, char const **argv)
 
 	// Stores each register in format: <register_name> = <value>.
 	vector<string> registers_debug_text;
+	// Stores each statistic in format: <name> <value>.
+	vector<string> stats_text;
 	// Stores which keys are pressed for debug.
 	bool keys_down[C8_KEY_CNT]{};
 	// Easliest key in the list which was pressed.
 	int pressed_key = C8_KEY_NONE;
 
 	// State control
-	int instr_per_frame = 5;
+	int instr_per_frame = std::max(1l, std::lround(ips / 60.0));
 	bool paused = false;
+	bool show_heatmap = false;
+	bool show_stats = false;
+	// Shown while paused, why the emulator stopped
+	const char *pause_text = "PAUSED";
+
+	// Runs the emulator, pausing it at breakpoints and watchpoints
+	auto run_emulator = [&](uint64_t steps) {
+		emu.key = static_cast<uint8_t>(pressed_key);
+		emu.run(steps);
+		switch (emu.stop_reason()) {
+		case StopReason::NONE:
+			break;
+		case StopReason::ILLEGAL:
+			clog << "Emulator: Illegal instruction!\n";
+			break;
+		case StopReason::BREAKPOINT:
+			paused = true;
+			pause_text = "BREAK";
+			break;
+		case StopReason::WATCHPOINT:
+			clog << "Emulator: Write to watched address 0x" << std::hex
+				 << emu.watch_address() << std::dec << '\n';
+			paused = true;
+			pause_text = "WATCH";
+			break;
+		}
+	};
 
 	while (!WindowShouldClose()) {
 		// Handle key UI presses
@@ -223,19 +389,48 @@ int main(int argc, char const **argv)
 			instr_per_frame--;
 		else if (!paused && IsKeyPressed(KEY_RIGHT))
 			instr_per_frame++;
-		if (IsKeyPressed(KEY_SPACE))
+		if (IsKeyPressed(KEY_SPACE)) {
 			paused = !paused;
-		else if (IsKeyPressed(KEY_ENTER))
+			pause_text = "PAUSED";
+			// Continuing goes past a breakpoint at PC
+			emu.skip_breakpoint();
+		} else if (IsKeyPressed(KEY_ENTER)) {
 			emu = Emulator(rom, rom + bin_size);
+			emu.set_quirks(QUIRK_PROFILES[static_cast<int>(quirks)]);
+			heatmap = std::make_unique<Heatmap>();
+			emu.set_heatmap(show_heatmap ? heatmap.get() : nullptr);
+			emu.set_breakpoints(&breakpoints);
+		}
+		if (IsKeyPressed(KEY_B))
+			breakpoints.toggle(emu.pc % C8_RAM_SIZE);
+		// A click on an instruction toggles a breakpoint there
+		Vector2 mouse = GetMousePosition();
+		if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)
+			&& CheckCollisionPointRec(mouse, INSTR_DEBUG_BOX)) {
+			auto line = std::floor(
+				(mouse.y - INSTR_DEBUG_BOX.y - TEXT_PADDING) / FONT_LINE_HEIGHT
+			);
+			auto addr = static_cast<long>(emu.pc)
+						+ C8_INS_LEN * (long(line) - INSTR_DECODE_CONTEXT);
+			if (line >= 0 && line <= 2 * INSTR_DECODE_CONTEXT && addr >= 0
+				&& addr + C8_INS_LEN <= C8_RAM_SIZE)
+				breakpoints.toggle(addr);
+		}
+		if (IsKeyPressed(KEY_H)) {
+			show_heatmap = !show_heatmap;
+			emu.set_heatmap(show_heatmap ? heatmap.get() : nullptr);
+		}
+		if (IsKeyPressed(KEY_TAB))
+			show_stats = !show_stats;
 
 		// If multiple keys are pressed then for the emulator we register
 		// the key which was pressed earliest.
 		// Therefore, if the same key is still pressed then maintain it.
-		if (pressed_key != C8_KEY_NONE && IsKeyUp(C8_KEY_MAP[pressed_key]))
+		if (pressed_key != C8_KEY_NONE && IsKeyUp(key_map[pressed_key]))
 			pressed_key = C8_KEY_NONE;
 
 		for (unsigned i = 0; i < ARRAY_SIZE(keys_down); ++i) {
-			keys_down[i] = IsKeyDown(C8_KEY_MAP[i]);
+			keys_down[i] = IsKeyDown(key_map[i]);
 
 			if (keys_down[i] && pressed_key == C8_KEY_NONE)
 				pressed_key = i;
@@ -255,7 +450,7 @@ int main(int argc, char const **argv)
 		// Debug chip frequency(instructions per second), lower left corner.
 		auto hz_str = to_string(GetFPS() * instr_per_frame) + "Hz";
 		if (paused)
-			hz_str = "PAUSED";
+			hz_str = pause_text;
 		draw_padded_font(
 			hz_str.c_str(), {SCREEN_W - 120, SCREEN_H - 60}, RAYWHITE
 		);
@@ -274,6 +469,16 @@ int main(int argc, char const **argv)
 			Vector2 pos = get_rect_pos(INSTR_DEBUG_BOX);
 			pos.y += FONT_LINE_HEIGHT * (i + INSTR_DECODE_CONTEXT);
 
+			// Mark breakpoints in the padding before the instruction,
+			// conditional ones in another color
+			if (ins_str != "~" && breakpoints.exec[new_pc]) {
+				Vector2 mark = {
+					pos.x + TEXT_PADDING, pos.y + TEXT_PADDING + FONT_SIZE / 2
+				};
+				bool is_conditional = breakpoints.conditions.count(new_pc);
+				DrawCircleV(mark, 5, is_conditional ? ORANGE : SKYBLUE);
+			}
+
 			// Highlight the current instruction in golden color.
 			Color color = i == 0 ? GOLD : RED;
 			draw_padded_font(ins_str.c_str(), pos, color);
@@ -298,7 +503,8 @@ int main(int argc, char const **argv)
 			pos.x += KEY_BLOCK_SIZE * (i % 4);
 			pos.y += KEY_BLOCK_SIZE * (i / 4);
 
-			auto [keycode, c8_key_name, key_name] = C8_KEY_NAME_MAP[i];
+			auto [keycode, c8_key_name] = C8_KEY_NAME_MAP[i];
+			char key_name[] = {char(key_map[keycode]), '\0'};
 			Color color = GRAY; // For keys not currently down.
 			if (keys_down[keycode])
 				color = MAROON; // For keys which are currently down.
@@ -319,8 +525,10 @@ int main(int argc, char const **argv)
 		// So that outer border is also 2px thick.
 		DrawRectangleLinesEx(KEY_PRESS_DEBUG_BOX, 2., DARKGREEN);
 
-		// Draw the emulator screen
-		for (int y = 0; y < C8_SCREEN_HEIGHT; ++y) {
+		// Draw the emulator screen, or the RAM heatmap in its place
+		if (show_heatmap)
+			draw_heatmap(*heatmap);
+		for (int y = 0; y < C8_SCREEN_HEIGHT && !show_heatmap; ++y) {
 			for (int x = 0; x < C8_SCREEN_WIDTH; ++x) {
 				if (!emu.pixel(x, y))
 					continue;
@@ -330,13 +538,37 @@ int main(int argc, char const **argv)
 			}
 		}
 
-		// Draw help text
+		// Draw help text, or the statistics in its place
 		Vector2 pos = get_rect_pos(INFO_BOX);
-		draw_padded_font("Left/Right: Speed(-/+)", pos, RAYWHITE);
-		pos.y += float(FONT_LINE_HEIGHT);
-		draw_padded_font("Space     : Play/Pause", pos, RAYWHITE);
-		pos.y += float(FONT_LINE_HEIGHT);
-		draw_padded_font("Enter     : Reset", pos, RAYWHITE);
+		if (show_stats) {
+			fmt_stats(emu.get_stats(), stats_text);
+			for (auto &txt : stats_text) {
+				draw_padded_font(txt.c_str(), pos, RAYWHITE);
+				pos.y += float(FONT_LINE_HEIGHT);
+			}
+		} else {
+			draw_padded_font("Left/Right: Speed(-/+)", pos, RAYWHITE);
+			pos.y += float(FONT_LINE_HEIGHT);
+			draw_padded_font("Space     : Break/Run", pos, RAYWHITE);
+			pos.y += float(FONT_LINE_HEIGHT);
+			draw_padded_font("N         : Step", pos, RAYWHITE);
+			pos.y += float(FONT_LINE_HEIGHT);
+			draw_padded_font("B/Click   : Breakpoint", pos, RAYWHITE);
+			pos.y += float(FONT_LINE_HEIGHT);
+			draw_padded_font("Enter     : Reset", pos, RAYWHITE);
+			pos.y += float(FONT_LINE_HEIGHT);
+			draw_padded_font("H         : RAM heatmap", pos, RAYWHITE);
+			pos.y += float(FONT_LINE_HEIGHT);
+			draw_padded_font("Tab       : Statistics", pos, RAYWHITE);
+			pos.y += float(FONT_LINE_HEIGHT);
+		}
+		if (show_heatmap) {
+			draw_padded_font("Write", pos, RED);
+			pos.x += 110;
+			draw_padded_font("Read", pos, GREEN);
+			pos.x += 95;
+			draw_padded_font("Exec", pos, BLUE);
+		}
 
 		EndDrawing();
 		//--------------------------------------------------
@@ -345,16 +577,17 @@ int main(int argc, char const **argv)
 		//--------------------------------------------------
 		if (paused) {
 			PauseAudioStream(beep_stream);
+			// Single steps go past a breakpoint at PC like continuing does
+			if (IsKeyPressed(KEY_N)) {
+				emu.skip_breakpoint();
+				run_emulator(1);
+			}
 			emu.reset_clock(); // Stops timers while paused.
 			continue;
 		}
 
 		// Run code...
-		for (int i = 0; i < instr_per_frame; ++i) {
-			emu.key = static_cast<uint8_t>(pressed_key);
-			if (!emu.step())
-				clog << "Emulator: Illegal instruction!\n";
-		}
+		run_emulator(instr_per_frame);
 
 		// Beep play/pause as per sound timer.
 		if (emu.sound_timer() > 0)
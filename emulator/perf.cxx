@@ -0,0 +1,402 @@
+// Performance regression runner.
+// Runs the emulator and assembler benchmarks and a corpus of ROMs a number
+// of times, writes the results as JSON and compares them with a baseline
+// written by an earlier run, to tell if a change made anything slower.
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "chip8.hxx"
+#include "emulator.hxx"
+#include "json.hxx"
+
+namespace fs = std::filesystem;
+using std::clog;
+using std::string;
+using std::string_view;
+using std::uint64_t;
+using std::uint8_t;
+using std::vector;
+
+/// Version of the results file, bumped when its layout changes
+constexpr unsigned RESULTS_VERSION = 1;
+/// Changes smaller than this many standard deviations of the noise of the
+/// two results are noise
+constexpr double NOISE_SIGMAS = 3;
+/// Scales the median absolute deviation to the standard deviation of a
+/// normal distribution
+constexpr double MAD_TO_SIGMA = 1.4826;
+
+/// @brief Options from the command line
+struct Options {
+	string bin_dir;
+	const char *roms = nullptr;
+	const char *out = nullptr;
+	const char *baseline = nullptr;
+	const char *filter = nullptr;
+	unsigned runs = 5;
+	uint64_t steps = 1'000'000;
+	double min_seconds = 0.1;
+	double threshold = 0.05;
+	bool skip_asm = false;
+};
+
+/// @brief Times of a benchmark, nanoseconds per op of each run
+struct Series {
+	string name;
+	string unit;
+	vector<double> samples;
+
+	double median() const;
+	/// Median absolute deviation from the median
+	double mad() const;
+	/// Standard deviation of the noise, relative to the median
+	double rel_sigma() const
+	{
+		auto m = median();
+		return m > 0 ? MAD_TO_SIGMA * mad() / m : 0;
+	}
+};
+
+static double median_of(vector<double> vals)
+{
+	if (vals.empty())
+		return 0;
+	std::sort(vals.begin(), vals.end());
+	auto mid = vals.size() / 2;
+	return vals.size() % 2 ? vals[mid] : (vals[mid - 1] + vals[mid]) / 2;
+}
+
+double Series::median() const { return median_of(samples); }
+
+double Series::mad() const
+{
+	auto m = median();
+	vector<double> devs;
+	for (auto s : samples)
+		devs.push_back(std::fabs(s - m));
+	return median_of(devs);
+}
+
+/// @brief Series by name, in the order they were first added
+class Results
+{
+public:
+	void add(const string &name, const string &unit, double ns)
+	{
+		auto [it, is_new] = index.try_emplace(name, series.size());
+		if (is_new)
+			series.push_back({name, unit, {}});
+		series[it->second].samples.push_back(ns);
+	}
+	const Series *find(const string &name) const
+	{
+		auto it = index.find(name);
+		return it == index.end() ? nullptr : &series[it->second];
+	}
+	const vector<Series> &all() const { return series; }
+
+	Json to_json() const;
+	/// @return false if the JSON is not a results file
+	bool from_json(const Json &json);
+
+private:
+	vector<Series> series;
+	std::map<string, size_t> index;
+};
+
+Json Results::to_json() const
+{
+	Json ret;
+	ret["version"] = RESULTS_VERSION;
+	ret["results"] = Json::Array{};
+	for (auto &s : series) {
+		Json item;
+		item["name"] = s.name;
+		item["unit"] = s.unit;
+		item["median_ns"] = s.median();
+		item["mad_ns"] = s.mad();
+		item["samples_ns"] = Json::Array(s.samples.begin(), s.samples.end());
+		ret["results"].push_back(std::move(item));
+	}
+	return ret;
+}
+
+bool Results::from_json(const Json &json)
+{
+	if (json["version"].as_number() != RESULTS_VERSION)
+		return false;
+	for (auto &item : json["results"].as_array()) {
+		for (auto &sample : item["samples_ns"].as_array())
+			add(item["name"].as_string(), item["unit"].as_string(),
+				sample.as_number());
+	}
+	return true;
+}
+
+/// @brief Quote for the shell
+static string quote(string_view arg)
+{
+	string ret = "'";
+	for (auto c : arg) {
+		if (c == '\'')
+			ret += "'\\''";
+		else
+			ret += c;
+	}
+	return ret + "'";
+}
+
+/// @brief Run a benchmark which prints a JSON array of results, adding a
+/// sample of each result
+/// @return false if it cannot be run or its output is not such an array
+static bool run_bench(const string &command, Results &results)
+{
+	auto pipe = popen(command.c_str(), "r");
+	if (!pipe) {
+		clog << "Cannot run '" << command << "'\n";
+		return false;
+	}
+	string output;
+	char buf[4096];
+	for (size_t n; (n = std::fread(buf, 1, sizeof(buf), pipe)) > 0;)
+		output.append(buf, n);
+	auto status = pclose(pipe);
+
+	auto json = Json::parse(output);
+	if (status != 0 || !json || json->get_type() != Json::Type::ARRAY) {
+		clog << "Benchmark '" << command << "' failed\n";
+		return false;
+	}
+	for (auto &item : json->as_array())
+		results.add(
+			item["name"].as_string(), item["unit"].as_string(),
+			item["ns_per_op"].as_number()
+		);
+	return true;
+}
+
+/// @brief ROMs of the corpus: the .ch8 files of a directory, by name
+static vector<fs::path> corpus_roms(const char *dir)
+{
+	vector<fs::path> ret;
+	std::error_code ec;
+	for (auto &entry : fs::directory_iterator(dir, ec)) {
+		if (entry.is_regular_file() && entry.path().extension() == ".ch8")
+			ret.push_back(entry.path());
+	}
+	if (ec)
+		clog << "Cannot read directory '" << dir << "'\n";
+	std::sort(ret.begin(), ret.end());
+	return ret;
+}
+
+/// @brief Run a ROM for a number of steps like c8run, adding a sample of
+/// the time of a step
+/// @return false if the ROM cannot be loaded or runs no steps
+static bool run_rom(const fs::path &path, uint64_t steps, Results &results)
+{
+	std::ifstream rom_file(path, std::ios::binary);
+	if (!rom_file) {
+		clog << "Cannot open file '" << path.string() << "'\n";
+		return false;
+	}
+	uint8_t rom[C8_RAM_SIZE]{};
+	rom_file.read(reinterpret_cast<char *>(rom), sizeof(rom));
+
+	Emulator emu(rom, rom + rom_file.gcount());
+	if (!emu)
+		return false;
+	emu.seed(1);
+	emu.set_step_time(1.0 / 300);
+	// Stopping at an illegal instruction is still a run, of fewer steps
+	auto done = emu.run(steps);
+	if (done == 0) {
+		clog << "ROM '" << path.string() << "' runs no steps\n";
+		return false;
+	}
+	results.add(
+		"corpus/" + path.filename().string(), "step",
+		emu.get_stats().step_seconds * 1e9 / done
+	);
+	return true;
+}
+
+/// @brief Print the results against the baseline
+/// @return true if any benchmark got slower by more than its noise
+static bool compare(const Results &baseline, const Results &results, double threshold)
+{
+	std::printf(
+		"%-24s %12s %12s %8s %8s\n", "name", "base ns/op", "ns/op", "change",
+		"noise"
+	);
+	bool is_regression = false;
+	for (auto &cur : results.all()) {
+		auto base = baseline.find(cur.name);
+		if (!base) {
+			std::printf("%-24s %12s %12.3f\n", cur.name.c_str(), "-", cur.median());
+			continue;
+		}
+		// Noise of both, but never less than the threshold
+		auto noise = std::max(
+			threshold, NOISE_SIGMAS * std::hypot(base->rel_sigma(), cur.rel_sigma())
+		);
+		auto change = cur.median() / base->median() - 1;
+		const char *verdict = "";
+		if (change > noise) {
+			verdict = "  SLOWER";
+			is_regression = true;
+		} else if (change < -noise) {
+			verdict = "  faster";
+		}
+		std::printf(
+			"%-24s %12.3f %12.3f %+7.1f%% %7.1f%%%s\n", cur.name.c_str(),
+			base->median(), cur.median(), change * 100, noise * 100, verdict
+		);
+	}
+	for (auto &base : baseline.all()) {
+		if (!results.find(base.name))
+			std::printf("%-24s %12.3f %12s\n", base.name.c_str(), base.median(), "-");
+	}
+	return is_regression;
+}
+
+static void print_usage(const char *name)
+{
+	clog << "Usage: " << name << " [options]\n"
+		 << "  Run the benchmarks and the ROM corpus, exits with 0 if nothing\n"
+		 << "  got slower than the baseline, 1 if something did and 2 on\n"
+		 << "  errors\n"
+		 << "Options:\n"
+		 << "  --runs <n>         Runs of each benchmark (default: 5)\n"
+		 << "  --min-time <s>     Seconds each benchmark spends on each of\n"
+		 << "                     its workloads a run (default: 0.1)\n"
+		 << "  --filter <text>    Only emulator workloads whose name has <text>\n"
+		 << "  --no-asm           Do not run the assembler benchmark\n"
+		 << "  --roms <dir>       Also run each .ch8 ROM of this directory\n"
+		 << "  -n <steps>         Steps to run each ROM (default: 1000000)\n"
+		 << "  --out <file>       Write the results as JSON\n"
+		 << "  --baseline <file>  Compare with these results(--out of an\n"
+		 << "                     earlier run)\n"
+		 << "  --threshold <pct>  Smallest change which is not noise\n"
+		 << "                     (default: 5)\n"
+		 << "  --bin <dir>        Directory of c8emu_bench and c8asm_bench\n"
+		 << "                     (default: the directory of this program)\n";
+}
+
+static bool parse_options(int argc, char const **argv, Options &opts)
+{
+	for (int i = 1; i < argc; ++i) {
+		string_view arg = argv[i];
+		bool has_value = i + 1 < argc;
+		if (arg == "--runs" && has_value) {
+			opts.runs = std::strtoul(argv[++i], nullptr, 10);
+		} else if (arg == "--min-time" && has_value) {
+			opts.min_seconds = std::strtod(argv[++i], nullptr);
+		} else if (arg == "--filter" && has_value) {
+			opts.filter = argv[++i];
+		} else if (arg == "--no-asm") {
+			opts.skip_asm = true;
+		} else if (arg == "--roms" && has_value) {
+			opts.roms = argv[++i];
+		} else if (arg == "-n" && has_value) {
+			opts.steps = std::strtoull(argv[++i], nullptr, 10);
+		} else if (arg == "--out" && has_value) {
+			opts.out = argv[++i];
+		} else if (arg == "--baseline" && has_value) {
+			opts.baseline = argv[++i];
+		} else if (arg == "--threshold" && has_value) {
+			opts.threshold = std::strtod(argv[++i], nullptr) / 100;
+		} else if (arg == "--bin" && has_value) {
+			opts.bin_dir = argv[++i];
+		} else {
+			return false;
+		}
+	}
+	return opts.runs != 0;
+}
+
+int main(int argc, char const **argv)
+{
+	Options opts;
+	if (!parse_options(argc, argv, opts)) {
+		print_usage(argc > 0 ? argv[0] : "c8perf");
+		return 2;
+	}
+	if (opts.bin_dir.empty() && argc > 0)
+		opts.bin_dir = fs::path(argv[0]).parent_path().string();
+	if (opts.bin_dir.empty())
+		opts.bin_dir = ".";
+
+	// Read first, not to find out it is missing after all the runs
+	Results baseline;
+	if (opts.baseline) {
+		std::ifstream base_file(opts.baseline);
+		if (!base_file) {
+			clog << "Cannot open file '" << opts.baseline << "'\n";
+			return 2;
+		}
+		std::stringstream text;
+		text << base_file.rdbuf();
+		auto json = Json::parse(text.str());
+		if (!json || !baseline.from_json(*json)) {
+			clog << "File '" << opts.baseline << "' is not a results file\n";
+			return 2;
+		}
+	}
+
+	auto min_time = std::to_string(opts.min_seconds);
+	auto emu_bench = quote(opts.bin_dir + "/c8emu_bench") + " --json --min-time "
+					 + min_time;
+	if (opts.filter)
+		emu_bench += " --filter " + quote(opts.filter);
+	auto asm_bench = quote(opts.bin_dir + "/c8asm_bench")
+					 + " --json --max-lines 100000 --min-time " + min_time;
+	auto roms = opts.roms ? corpus_roms(opts.roms) : vector<fs::path>{};
+
+	// Runs interleave the benchmarks, so that a slow spell of the machine
+	// is spread over all of them
+	Results results;
+	for (unsigned run = 0; run < opts.runs; ++run) {
+		clog << "Run " << run + 1 << "/" << opts.runs << '\n';
+		if (!run_bench(emu_bench, results))
+			return 2;
+		if (!opts.skip_asm && !run_bench(asm_bench, results))
+			return 2;
+		for (auto &rom : roms) {
+			if (!run_rom(rom, opts.steps, results))
+				return 2;
+		}
+	}
+
+	if (opts.out) {
+		std::ofstream out_file(opts.out);
+		if (!out_file) {
+			clog << "Cannot open file '" << opts.out << "'\n";
+			return 2;
+		}
+		out_file << results.to_json().dump() << '\n';
+	}
+
+	if (!opts.baseline) {
+		std::printf("%-24s %12s %8s\n", "name", "ns/op", "noise");
+		for (auto &s : results.all())
+			std::printf(
+				"%-24s %12.3f %7.1f%%\n", s.name.c_str(), s.median(),
+				NOISE_SIGMAS * s.rel_sigma() * 100
+			);
+		return 0;
+	}
+	return compare(baseline, results, opts.threshold) ? 1 : 0;
+}
@@ -0,0 +1,230 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <istream>
+#include <sstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "chip8.hxx"
+#include "decoder.hxx"
+#include "emulator.hxx"
+#include "profile.hxx"
+
+using std::string;
+using std::uint64_t;
+using std::vector;
+
+/// Addresses listed as the hottest ones
+constexpr unsigned HOTTEST_CNT = 10;
+
+uint64_t Profile::total() const
+{
+	uint64_t ret = 0;
+	for (auto n : ins_hits)
+		ret += n;
+	return ret;
+}
+
+static double percent(uint64_t n, uint64_t total)
+{
+	return total == 0 ? 0 : 100.0 * double(n) / double(total);
+}
+
+// Addresses of counters are even, so always a whole instruction in RAM
+static string disassemble(const Emulator &emu, unsigned addr)
+{
+	return DecodedIns(emu.fetch_ins(addr)).to_string();
+}
+
+/// @brief Prefix a line of the assembler listing with the hits of its code.
+/// Listing lines are: <address>\t<bytes>\t<source line>, in hex.
+static void annotate_listing_line(
+	string &out, const Profile &profile, uint64_t total, const string &line
+)
+{
+	char buf[64];
+	auto tab = line.find('\t');
+	auto tab2 = tab == string::npos ? tab : line.find('\t', tab + 1);
+	auto size = tab2 == string::npos ? 0 : (tab2 - tab - 1) / 2;
+
+	if (size == 0) {
+		std::snprintf(buf, sizeof(buf), "%12s %7s  ", "", "");
+	} else {
+		auto addr = std::strtoul(line.substr(0, tab).c_str(), nullptr, 16);
+		uint64_t hits = 0;
+		for (auto i = addr / C8_INS_LEN;
+			 i <= (addr + size - 1) / C8_INS_LEN && i < Profile::SLOT_CNT; ++i)
+			hits += profile.hits[i];
+		std::snprintf(
+			buf, sizeof(buf), "%12llu %6.2f%%  ", (unsigned long long)hits,
+			percent(hits, total)
+		);
+	}
+	out += buf;
+	out += line;
+	out += '\n';
+}
+
+void write_profile(
+	std::ostream &os, const Profile &profile, const Emulator &emu,
+	unsigned rom_size, std::istream *listing
+)
+{
+	auto total = profile.total();
+	string out;
+	char buf[128];
+
+	std::snprintf(
+		buf, sizeof(buf),
+		"Steps: %llu\n\nHottest addresses:\n%12s %7s  %-4s  %s\n",
+		(unsigned long long)total, "hits", "%", "addr", "instruction"
+	);
+	out += buf;
+	vector<unsigned> slots(Profile::SLOT_CNT);
+	for (unsigned i = 0; i < slots.size(); ++i)
+		slots[i] = i;
+	auto hot_cnt = std::min<size_t>(HOTTEST_CNT, slots.size());
+	std::partial_sort(
+		slots.begin(), slots.begin() + hot_cnt, slots.end(),
+		[&profile](unsigned a, unsigned b) {
+			return profile.hits[a] > profile.hits[b]
+				   || (profile.hits[a] == profile.hits[b] && a < b);
+		}
+	);
+	for (size_t i = 0; i < hot_cnt && profile.hits[slots[i]] != 0; ++i) {
+		auto hits = profile.hits[slots[i]];
+		auto addr = slots[i] * C8_INS_LEN;
+		std::snprintf(
+			buf, sizeof(buf), "%12llu %6.2f%%  %04X  %s\n",
+			(unsigned long long)hits, percent(hits, total), addr,
+			disassemble(emu, addr).c_str()
+		);
+		out += buf;
+	}
+
+	// Host ticks are TSC cycles on x86, they are only comparable between
+	// instruction types of the same run.
+	std::snprintf(
+		buf, sizeof(buf), "\nInstruction types:\n%12s %7s %14s %10s  %s\n",
+		"steps", "%", "ticks", "ticks/step", "type"
+	);
+	out += buf;
+	for (int i = 0; i < INSTRUCTION_CNT; ++i) {
+		auto hits = profile.ins_hits[i];
+		if (hits == 0)
+			continue;
+		auto ticks = profile.ins_ticks[i];
+		std::snprintf(
+			buf, sizeof(buf), "%12llu %6.2f%% %14llu %10.1f  %s\n",
+			(unsigned long long)hits, percent(hits, total),
+			(unsigned long long)ticks, double(ticks) / double(hits),
+			string(ins_format(Instruction(i))).c_str()
+		);
+		out += buf;
+	}
+
+	out += "\nListing:\n";
+	if (listing) {
+		string line;
+		while (std::getline(*listing, line))
+			annotate_listing_line(out, profile, total, line);
+	} else {
+		// The program, and any other address executed(like code in data)
+		auto rom_end = C8_PROG_START + rom_size;
+		for (unsigned i = 0; i < Profile::SLOT_CNT; ++i) {
+			auto addr = i * C8_INS_LEN;
+			auto hits = profile.hits[i];
+			if (hits == 0 && (addr < C8_PROG_START || addr >= rom_end))
+				continue;
+			std::snprintf(
+				buf, sizeof(buf), "%12llu %6.2f%%  %04X\t%04X\t%s\n",
+				(unsigned long long)hits, percent(hits, total), addr,
+				emu.fetch_ins(addr), disassemble(emu, addr).c_str()
+			);
+			out += buf;
+		}
+	}
+
+	os << out;
+}
+
+CallGraph::CallGraph()
+{
+	nodes.push_back(Node{C8_PROG_START, 0, 0});
+}
+
+void CallGraph::load_symbols(std::istream &is)
+{
+	string line;
+	while (std::getline(is, line)) {
+		std::istringstream fields(line);
+		unsigned addr;
+		string label;
+		// The first label of an address names it
+		if (fields >> std::hex >> addr >> label)
+			symbols.emplace(addr, label);
+	}
+}
+
+void CallGraph::enter(std::uint16_t addr)
+{
+	if (nodes[current].depth == MAX_DEPTH) {
+		overflow++;
+		return;
+	}
+
+	auto key = std::uint64_t(current) << 16 | addr;
+	auto [child, is_new] = children.emplace(key, nodes.size());
+	if (is_new)
+		nodes.push_back(Node{addr, current, nodes[current].depth + 1});
+	current = child->second;
+}
+
+void CallGraph::leave()
+{
+	// A RET without a CALL, like into the caller's caller, stays at the
+	// program start
+	if (overflow != 0)
+		overflow--;
+	else if (current != 0)
+		current = nodes[current].parent;
+}
+
+string CallGraph::name(std::uint16_t addr) const
+{
+	if (auto sym = symbols.find(addr); sym != symbols.end())
+		return sym->second;
+	char buf[8];
+	std::snprintf(buf, sizeof(buf), "0x%03X", addr);
+	return buf;
+}
+
+void CallGraph::write_folded(std::ostream &os, Weight weight) const
+{
+	string out;
+	vector<std::uint32_t> stack;
+	for (std::uint32_t i = 0; i < nodes.size(); ++i) {
+		auto &node = nodes[i];
+		auto count = weight == Weight::RETIRED ? node.instructions
+													: node.drw_ticks;
+		if (count == 0)
+			continue;
+
+		stack.clear();
+		for (auto n = i; n != 0; n = nodes[n].parent)
+			stack.push_back(n);
+		stack.push_back(0);
+		for (auto n = stack.rbegin(); n != stack.rend(); ++n) {
+			if (n != stack.rbegin())
+				out += ';';
+			out += name(nodes[*n].addr);
+		}
+		out += ' ';
+		out += std::to_string(count);
+		out += '\n';
+	}
+	os << out;
+}
@@ -0,0 +1,128 @@
+#ifndef CHIP8_PROFILE_HXX_INCLUDED
+#define CHIP8_PROFILE_HXX_INCLUDED
+
+#include <cstdint>
+#include <chrono>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "chip8.hxx"
+
+class Emulator;
+
+/// @brief Cheapest host clock available: the time stamp counter on x86,
+/// nanoseconds elsewhere. Only differences of it are meaningful.
+inline std::uint64_t host_ticks()
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	using namespace std::chrono;
+	return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
+		.count();
+#endif
+}
+
+/// @brief Execution counts of an emulator run, see Emulator::set_profile()
+struct Profile {
+	/// Instructions are 2 bytes, so a counter for every 2 bytes of RAM.
+	/// An odd address shares the counter of the even one before it.
+	static constexpr unsigned SLOT_CNT = C8_RAM_SIZE / C8_INS_LEN;
+
+	/// Steps at each address, indexed by address / 2
+	std::uint64_t hits[SLOT_CNT]{};
+	/// Steps and host ticks spent by each instruction type
+	std::uint64_t ins_hits[INSTRUCTION_CNT]{};
+	std::uint64_t ins_ticks[INSTRUCTION_CNT]{};
+
+	void add(std::uint16_t pc, Instruction type, std::uint64_t ticks)
+	{
+		hits[pc % C8_RAM_SIZE / C8_INS_LEN]++;
+		ins_hits[static_cast<int>(type)]++;
+		ins_ticks[static_cast<int>(type)] += ticks;
+	}
+	std::uint64_t total() const;
+};
+
+/// @brief Write the profile report: the hottest addresses, time spent by
+/// each instruction type and an annotated listing of the program.
+/// The listing is the assembler listing(c8asm --lst) if one is given,
+/// else a disassembly of the ROM and of everything else executed.
+/// @param rom_size Bytes of the program, loaded from C8_PROG_START
+/// @param listing Assembler listing of the program, can be nullptr
+void write_profile(
+	std::ostream &os, const Profile &profile, const Emulator &emu,
+	unsigned rom_size, std::istream *listing
+);
+
+/// @brief Shadow call stack of an emulator run, kept by following CALL and
+/// RET, with the instructions retired and the host ticks spent drawing by
+/// each stack. See Emulator::set_call_graph().
+class CallGraph
+{
+public:
+	/// What the folded stacks are weighted by
+	enum class Weight {
+		RETIRED,
+		DRW_TICKS,
+	};
+
+	CallGraph();
+
+	/// @brief Name functions by the labels of a symbol map(c8asm --sym),
+	/// lines of: <address> <label>, address in hex. Others are named by
+	/// their address.
+	void load_symbols(std::istream &is);
+
+	/// @brief Count an instruction retired
+	/// @param pc PC after the instruction, the target of a CALL
+	void add(Instruction type, std::uint16_t pc, std::uint64_t ticks)
+	{
+		auto &node = nodes[current];
+		node.instructions++;
+		if (type == Instruction::DRW_v_v_n)
+			node.drw_ticks += ticks;
+		else if (type == Instruction::CALL_a)
+			enter(pc);
+		else if (type == Instruction::RET)
+			leave();
+	}
+
+	/// @brief Write the stacks in the folded format of flamegraph tools, a
+	/// line for each stack: <caller>;<callee>;... <weight>
+	void write_folded(std::ostream &os, Weight weight) const;
+
+private:
+	/// Calls deeper than this are counted in the deepest function, as the
+	/// CHIP-8 stack wraps around beyond it anyway
+	static constexpr unsigned MAX_DEPTH = C8_STACK_SIZE;
+
+	// A call stack, a node of the tree of calls from the program start
+	struct Node {
+		std::uint16_t addr;
+		std::uint32_t parent;
+		unsigned depth;
+		std::uint64_t instructions = 0;
+		std::uint64_t drw_ticks = 0;
+	};
+
+	void enter(std::uint16_t addr);
+	void leave();
+	std::string name(std::uint16_t addr) const;
+
+	std::vector<Node> nodes;
+	// Node of each call: (parent node << 16 | address) to node
+	std::unordered_map<std::uint64_t, std::uint32_t> children;
+	std::map<std::uint16_t, std::string> symbols;
+	std::uint32_t current = 0;
+	// Calls beyond MAX_DEPTH not returned from yet
+	unsigned overflow = 0;
+};
+
+#endif // END profile.hxx
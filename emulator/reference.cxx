@@ -0,0 +1,239 @@
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include "chip8.hxx"
+#include "emulator.hxx"
+#include "reference.hxx"
+
+using std::uint16_t;
+using std::uint64_t;
+using std::uint8_t;
+
+Reference::Reference(const uint8_t *rom_beg, const uint8_t *rom_end)
+{
+	auto font = &FONT_SPRITES[0][0];
+	std::copy(font, font + sizeof(FONT_SPRITES), ram);
+	auto size = std::min<long>(rom_end - rom_beg, C8_RAM_SIZE - C8_PROG_START);
+	std::copy(rom_beg, rom_beg + size, ram + C8_PROG_START);
+}
+
+uint8_t Reference::delay_timer() const { return std::lround(dtimer); }
+uint8_t Reference::sound_timer() const { return std::lround(stimer); }
+
+bool Reference::step()
+{
+	dtimer = std::max(0.0, dtimer - step_time * C8_TIMER_FREQ);
+	stimer = std::max(0.0, stimer - step_time * C8_TIMER_FREQ);
+
+	if (wait_for_key) {
+		if (key == C8_KEY_NONE)
+			return true;
+		regs[key_reg] = key;
+		pc += C8_INS_LEN;
+		wait_for_key = false;
+	}
+
+	unsigned op = ram[pc % C8_RAM_SIZE] << 8 | ram[(pc + 1) % C8_RAM_SIZE];
+	unsigned x = op >> 8 & 0xF;
+	unsigned y = op >> 4 & 0xF;
+	unsigned n = op & 0xF;
+	unsigned kk = op & 0xFF;
+	unsigned nnn = op & 0xFFF;
+	auto &vf = regs[C8_FLAG_REG];
+	uint16_t next = pc + C8_INS_LEN;
+	// Vx gets the result first, then VF the flag, which wins if x is F
+	auto set_flag = [&](unsigned result, bool flag) {
+		regs[x] = result & 0xFF;
+		vf = flag;
+	};
+	unsigned vx = regs[x];
+	unsigned vy = regs[y];
+
+	switch (op >> 12) {
+	case 0x0:
+		if (op == 0x00E0)
+			std::fill(std::begin(screen), std::end(screen), 0);
+		else if (op == 0x00EE)
+			next = stack[--sp % C8_STACK_SIZE];
+		// SYS is ignored
+		break;
+	case 0x1:
+		next = nnn;
+		break;
+	case 0x2:
+		stack[sp++ % C8_STACK_SIZE] = next;
+		next = nnn;
+		break;
+	case 0x3:
+		if (regs[x] == kk)
+			next += C8_INS_LEN;
+		break;
+	case 0x4:
+		if (regs[x] != kk)
+			next += C8_INS_LEN;
+		break;
+	case 0x5:
+		// The low nibble is not checked, like the decoder does
+		if (regs[x] == regs[y])
+			next += C8_INS_LEN;
+		break;
+	case 0x6:
+		regs[x] = kk;
+		break;
+	case 0x7:
+		regs[x] += kk;
+		break;
+	case 0x8:
+		switch (n) {
+		case 0x0:
+			regs[x] = regs[y];
+			break;
+		case 0x1:
+			regs[x] |= regs[y];
+			break;
+		case 0x2:
+			regs[x] &= regs[y];
+			break;
+		case 0x3:
+			regs[x] ^= regs[y];
+			break;
+		case 0x4:
+			// VF is the carry
+			set_flag(vx + vy, vx + vy > 0xFF);
+			break;
+		case 0x5:
+			// VF is NOT borrow
+			set_flag(vx - vy, vx >= vy);
+			break;
+		case 0x6:
+			set_flag(vx >> 1, vx & 1);
+			break;
+		case 0x7:
+			set_flag(vy - vx, vy >= vx);
+			break;
+		case 0xE:
+			set_flag(vx << 1, vx >> 7);
+			break;
+		default:
+			return false;
+		}
+		break;
+	case 0x9:
+		if (regs[x] != regs[y])
+			next += C8_INS_LEN;
+		break;
+	case 0xA:
+		index = nnn;
+		break;
+	case 0xB:
+		next = regs[0] + nnn;
+		break;
+	case 0xC:
+		regs[x] = std::uniform_int_distribution<unsigned>(0, 255)(rand_gen) & kk;
+		break;
+	case 0xD:
+		draw(regs[x], regs[y], n);
+		break;
+	case 0xE:
+		if (kk == 0x9E && key != C8_KEY_NONE && regs[x] == key)
+			next += C8_INS_LEN;
+		else if (kk == 0xA1 && (key == C8_KEY_NONE || regs[x] != key))
+			next += C8_INS_LEN;
+		else if (kk != 0x9E && kk != 0xA1)
+			return false;
+		break;
+	case 0xF:
+		switch (kk) {
+		case 0x07:
+			regs[x] = delay_timer();
+			break;
+		case 0x0A:
+			// Stays here till a key is pressed
+			key_reg = x;
+			wait_for_key = true;
+			next = pc;
+			break;
+		case 0x15:
+			dtimer = regs[x];
+			break;
+		case 0x18:
+			stimer = regs[x];
+			break;
+		case 0x1E:
+			index += regs[x];
+			break;
+		case 0x29:
+			index = C8_FONT_HEIGHT * regs[x];
+			break;
+		case 0x33:
+			ram[index % C8_RAM_SIZE] = regs[x] / 100;
+			ram[(index + 1) % C8_RAM_SIZE] = regs[x] / 10 % 10;
+			ram[(index + 2) % C8_RAM_SIZE] = regs[x] % 10;
+			break;
+		case 0x55:
+			for (unsigned i = 0; i <= x; ++i)
+				ram[(index + i) % C8_RAM_SIZE] = regs[i];
+			break;
+		case 0x65:
+			for (unsigned i = 0; i <= x; ++i)
+				regs[i] = ram[(index + i) % C8_RAM_SIZE];
+			break;
+		default:
+			return false;
+		}
+		break;
+	}
+
+	pc = next;
+	return true;
+}
+
+void Reference::draw(unsigned x, unsigned y, unsigned height)
+{
+	bool collision = false;
+	for (unsigned i = 0; i < height; ++i) {
+		auto &row = screen[(y + i) % C8_SCREEN_HEIGHT];
+		unsigned sprite = ram[(index + i) % C8_RAM_SIZE];
+		for (unsigned j = 0; j < 8; ++j) {
+			if (!(sprite >> (7 - j) & 1))
+				continue;
+			auto bit = uint64_t(1) << (x + j) % C8_SCREEN_WIDTH;
+			collision |= (row & bit) != 0;
+			row ^= bit;
+		}
+	}
+	regs[C8_FLAG_REG] = collision;
+}
+
+std::string differing_state(const Emulator &emu, const Reference &ref)
+{
+	std::string ret;
+	auto add = [&ret](bool differs, std::string_view name) {
+		if (!differs)
+			return;
+		if (!ret.empty())
+			ret += ", ";
+		ret += name;
+	};
+	add(emu.pc != ref.pc, "PC");
+	add(emu.index != ref.index, "I");
+	add(emu.sp != ref.sp, "SP");
+	add(emu.delay_timer() != ref.delay_timer(), "DT");
+	add(emu.sound_timer() != ref.sound_timer(), "ST");
+	add(emu.is_waiting_for_key() != ref.wait_for_key, "key wait");
+	for (int i = 0; i < C8_REG_CNT; ++i)
+		add(emu.regs[i] != ref.regs[i], REGISTERS[i]);
+	add(std::memcmp(emu.call_stack(), ref.stack, sizeof(ref.stack)) != 0,
+		"stack");
+	add(std::memcmp(emu.memory(), ref.ram, sizeof(ref.ram)) != 0, "RAM");
+	bool is_screen_same = true;
+	for (int y = 0; y < C8_SCREEN_HEIGHT; ++y)
+		is_screen_same &= emu.screen_row(y).to_ullong() == ref.screen[y];
+	add(!is_screen_same, "screen");
+	return ret;
+}
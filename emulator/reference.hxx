@@ -0,0 +1,57 @@
+#ifndef CHIP8_REFERENCE_HXX_INCLUDED
+#define CHIP8_REFERENCE_HXX_INCLUDED
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "chip8.hxx"
+
+class Emulator;
+
+/// @brief Reference model of the emulator, to run in lockstep with it and
+/// prove them equivalent. Written plainly and separately from Emulator:
+/// it decodes by nibbles itself and keeps the screen as bit rows. It keeps
+/// to the emulator's behaviour where CHIP-8 variants differ: SHR and SHL
+/// shift Vx in place, VF of SUB and SUBN is the carry of adding the two's
+/// complement, and an illegal instruction stops at itself.
+class Reference
+{
+public:
+	Reference(const std::uint8_t *rom_beg, const std::uint8_t *rom_end);
+	/// @return false on an illegal instruction, which is not executed
+	bool step();
+	/// Timers count down by a fixed time on every step, which must not be 0
+	void set_step_time(double seconds) { step_time = seconds; }
+	void seed(unsigned s) { rand_gen.seed(s); }
+
+	std::uint8_t delay_timer() const;
+	std::uint8_t sound_timer() const;
+
+	std::uint16_t pc = C8_PROG_START;
+	std::uint16_t index = 0;
+	std::uint8_t sp = 0;
+	std::uint8_t regs[C8_REG_CNT]{};
+	std::uint8_t key = C8_KEY_NONE;
+	std::uint16_t stack[C8_STACK_SIZE]{};
+	std::uint8_t ram[C8_RAM_SIZE]{};
+	/// Pixel x of a row is bit x
+	std::uint64_t screen[C8_SCREEN_HEIGHT]{};
+	bool wait_for_key = false;
+
+private:
+	void draw(unsigned x, unsigned y, unsigned height);
+
+	// Like the emulator's, to count down and round the same
+	float dtimer = 0;
+	float stimer = 0;
+	std::uint8_t key_reg = 0;
+	double step_time = 0;
+	std::default_random_engine rand_gen;
+};
+
+/// @brief Names of the parts of the state in which the emulator and the
+/// reference differ, like "PC, V3, RAM", empty if none
+std::string differing_state(const Emulator &emu, const Reference &ref);
+
+#endif // END reference.hxx
@@ -0,0 +1,49 @@
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
+
+#include "romdb.hxx"
+
+using std::uint64_t;
+using std::uint8_t;
+
+constexpr uint8_t NO_KEY = C8_KEY_NONE;
+
+// Known ROMs, sorted by hash for the binary search. `c8run --id <rom>`
+// prints the entry of a ROM, to be put in its place here.
+static constexpr RomInfo ROMS[] = {
+	// The sample programs of fuzz/corpus
+	{0x5A4E58C6B478BC3C, "key", QuirkProfile::DEFAULT, 60,
+	 {NO_KEY, NO_KEY, NO_KEY, NO_KEY}},
+	{0xA783E09BD705BEF0, "bounce", QuirkProfile::DEFAULT, 120,
+	 {NO_KEY, NO_KEY, NO_KEY, NO_KEY}},
+	{0xFF1999AA22942562, "ball", QuirkProfile::DEFAULT, 600,
+	 {0x5, 0x7, 0x8, 0x9}},
+};
+
+static constexpr bool is_sorted_by_hash()
+{
+	for (unsigned i = 1; i < std::size(ROMS); ++i) {
+		if (ROMS[i - 1].hash >= ROMS[i].hash)
+			return false;
+	}
+	return true;
+}
+static_assert(is_sorted_by_hash(), "ROMS must be sorted by hash, without duplicates");
+
+uint64_t rom_hash(const uint8_t *rom_beg, const uint8_t *rom_end)
+{
+	uint64_t hash = 0xCBF29CE484222325;
+	for (auto p = rom_beg; p != rom_end; ++p)
+		hash = (hash ^ *p) * 0x100000001B3;
+	return hash;
+}
+
+const RomInfo *find_rom(uint64_t hash)
+{
+	auto it = std::lower_bound(
+		std::begin(ROMS), std::end(ROMS), hash,
+		[](const RomInfo &info, uint64_t h) { return info.hash < h; }
+	);
+	return it != std::end(ROMS) && it->hash == hash ? it : nullptr;
+}
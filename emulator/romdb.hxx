@@ -0,0 +1,32 @@
+#ifndef CHIP8_ROMDB_HXX_INCLUDED
+#define CHIP8_ROMDB_HXX_INCLUDED
+
+#include <cstdint>
+
+#include "chip8.hxx"
+#include "emulator.hxx"
+
+/// Instructions per second of ROMs not in the database
+constexpr unsigned DEFAULT_IPS = 300;
+
+/// @brief What a known ROM needs to run right
+struct RomInfo {
+	/// rom_hash() of the ROM, the database is sorted by it
+	std::uint64_t hash;
+	const char *title;
+	QuirkProfile quirks;
+	/// Instructions per second
+	unsigned ips;
+	/// Keys for up, left, down and right, which frontends put on the keys
+	/// they use for directions. C8_KEY_NONE leaves a direction unbound.
+	std::uint8_t dpad[4];
+};
+
+/// @brief 64-bit FNV-1a of the ROM's bytes
+std::uint64_t rom_hash(const std::uint8_t *rom_beg, const std::uint8_t *rom_end);
+
+/// @brief Look a ROM up in the database by its hash
+/// @return nullptr if the ROM is not known
+const RomInfo *find_rom(std::uint64_t hash);
+
+#endif // END romdb.hxx
@@ -0,0 +1,134 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+
+#include "chip8.hxx"
+#include "decoder.hxx"
+#include "trace.hxx"
+
+using std::string;
+
+string format_record(const TraceRecord &rec)
+{
+	char buf[96];
+	auto len = std::snprintf(
+		buf, sizeof(buf), "%04X  %04X  %-20s I=%04X VF=%02X", rec.pc,
+		rec.opcode, DecodedIns(rec.opcode).to_string().c_str(), rec.index,
+		rec.vf
+	);
+	if (rec.reg != TRACE_NO_REG)
+		len += std::snprintf(
+			buf + len, sizeof(buf) - len, " V%X=%02X", rec.reg & 0xF, rec.value
+		);
+	if (rec.key != C8_KEY_NONE)
+		std::snprintf(buf + len, sizeof(buf) - len, " K=%X", rec.key & 0xF);
+	return buf;
+}
+
+TraceWriter::TraceWriter(const char *path)
+	: filling(BUFFER_RECORDS)
+	, writing(BUFFER_RECORDS)
+{
+	file = std::fopen(path, "wb");
+	if (!file) {
+		error = true;
+		return;
+	}
+
+	TraceHeader header;
+	if (std::fwrite(&header, sizeof(header), 1, file) != 1)
+		error = true;
+	writer = std::thread(&TraceWriter::write_loop, this);
+}
+
+TraceWriter::~TraceWriter() { close(); }
+
+void TraceWriter::hand_over()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	// The writer must be done with the other buffer first
+	cond.wait(lock, [this] { return write_cnt == 0; });
+	filling.swap(writing);
+	write_cnt = fill_cnt;
+	fill_cnt = 0;
+	cond.notify_all();
+}
+
+void TraceWriter::write_loop()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true) {
+		cond.wait(lock, [this] { return write_cnt != 0 || is_closing; });
+		if (write_cnt == 0)
+			return; // Closing and all written
+
+		// The buffer being written is not touched till write_cnt is 0
+		lock.unlock();
+		auto written =
+			std::fwrite(writing.data(), sizeof(TraceRecord), write_cnt, file);
+		lock.lock();
+		if (written != write_cnt)
+			error = true;
+		write_cnt = 0;
+		cond.notify_all();
+	}
+}
+
+bool TraceWriter::close()
+{
+	if (!file)
+		return !error;
+
+	if (fill_cnt != 0)
+		hand_over();
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		is_closing = true;
+	}
+	cond.notify_all();
+	writer.join();
+
+	if (std::fclose(file) != 0)
+		error = true;
+	file = nullptr;
+	return !error;
+}
+
+TraceReader::TraceReader(const char *path)
+{
+	file = std::fopen(path, "rb");
+	if (!file) {
+		std::clog << "Cannot open file '" << path << "'\n";
+		return;
+	}
+
+	TraceHeader expected, header;
+	if (std::fread(&header, sizeof(header), 1, file) != 1
+		|| std::memcmp(&header, &expected, sizeof(header)) != 0) {
+		std::clog << "'" << path << "' is not a trace of this version\n";
+		std::fclose(file);
+		file = nullptr;
+	}
+}
+
+TraceReader::~TraceReader()
+{
+	if (file)
+		std::fclose(file);
+}
+
+size_t TraceReader::read(TraceRecord *out, size_t n)
+{
+	return std::fread(out, sizeof(TraceRecord), n, file);
+}
+
+bool TraceReader::seek(std::uint64_t n)
+{
+	auto offset = sizeof(TraceHeader) + n * sizeof(TraceRecord);
+	if (std::fseek(file, 0, SEEK_END) != 0 || std::ftell(file) < long(offset))
+		return false;
+	return std::fseek(file, long(offset), SEEK_SET) == 0;
+}
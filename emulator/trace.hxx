@@ -0,0 +1,131 @@
+#ifndef CHIP8_TRACE_HXX_INCLUDED
+#define CHIP8_TRACE_HXX_INCLUDED
+
+#include <cstdint>
+#include <cstdio>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chip8.hxx"
+
+using std::uint16_t;
+using std::uint8_t;
+
+/// Register of a trace record which is none
+constexpr uint8_t TRACE_NO_REG = 0xFF;
+
+/// @brief An instruction executed, with the state it left.
+/// Trace files are a TraceHeader and then these records, back to back in
+/// the byte order of the host which wrote them.
+struct TraceRecord {
+	uint16_t pc;
+	uint16_t opcode;
+	uint16_t index;
+	/// Vx written by the instruction and its new value, reg is
+	/// TRACE_NO_REG if the instruction writes none
+	uint8_t reg;
+	uint8_t value;
+	uint8_t vf;
+	/// Key pressed, C8_KEY_NONE if none
+	uint8_t key;
+};
+static_assert(sizeof(TraceRecord) == 10, "Trace records must not have padding");
+
+struct TraceHeader {
+	char magic[4] = {'C', '8', 'T', 'R'};
+	uint16_t version = 1;
+	uint16_t record_size = sizeof(TraceRecord);
+};
+
+/// @brief Whether the instruction writes its Vx register, as recorded in
+/// traces. LD Vx, K is not one: Vx is written by a later step.
+inline bool writes_vx(Instruction type)
+{
+	using I = Instruction;
+	constexpr std::uint64_t MASK =
+		1ULL << int(I::LD_v_b) | 1ULL << int(I::ADD_v_b) | 1ULL << int(I::LD_v_v)
+		| 1ULL << int(I::OR_v_v) | 1ULL << int(I::AND_v_v)
+		| 1ULL << int(I::XOR_v_v) | 1ULL << int(I::ADD_v_v)
+		| 1ULL << int(I::SUB_v_v) | 1ULL << int(I::SHR_v)
+		| 1ULL << int(I::SUBN_v_v) | 1ULL << int(I::SHL_v)
+		| 1ULL << int(I::RND_v_b) | 1ULL << int(I::LD_v_DT)
+		| 1ULL << int(I::LD_v_IM);
+	static_assert(INSTRUCTION_CNT <= 64, "Instructions must fit the mask");
+	return (MASK >> int(type)) & 1;
+}
+
+/// @brief Record as a line of text: pc, opcode, disassembly and state
+std::string format_record(const TraceRecord &rec);
+
+/// @brief Writes trace records to a file from a background thread.
+/// Records are added to one buffer while the thread writes the other, so
+/// the emulator only waits if the disk is slower than it.
+class TraceWriter
+{
+public:
+	/// Records in each of the two buffers
+	static constexpr size_t BUFFER_RECORDS = 1 << 16;
+
+	/// @brief Create the file and write the header, check with operator bool
+	explicit TraceWriter(const char *path);
+	~TraceWriter();
+	TraceWriter(const TraceWriter &) = delete;
+	TraceWriter &operator=(const TraceWriter &) = delete;
+	explicit operator bool() const { return file && !error; }
+
+	void add(const TraceRecord &rec)
+	{
+		filling[fill_cnt++] = rec;
+		if (fill_cnt == BUFFER_RECORDS)
+			hand_over();
+	}
+
+	/// @brief Write out all records and close the file
+	/// @return false if any write failed
+	bool close();
+
+private:
+	void hand_over();
+	void write_loop();
+
+	std::FILE *file = nullptr;
+	std::vector<TraceRecord> filling;
+	size_t fill_cnt = 0;
+
+	// Buffer handed over to the writer thread, guarded by mutex
+	std::vector<TraceRecord> writing;
+	size_t write_cnt = 0;
+	bool is_closing = false;
+	// Also set by the writer thread
+	std::atomic<bool> error{false};
+	std::mutex mutex;
+	std::condition_variable cond;
+	std::thread writer;
+};
+
+/// @brief Reads trace records from a file, a buffer at a time
+class TraceReader
+{
+public:
+	/// @brief Open the file and check its header, check with operator bool
+	explicit TraceReader(const char *path);
+	~TraceReader();
+	TraceReader(const TraceReader &) = delete;
+	TraceReader &operator=(const TraceReader &) = delete;
+	explicit operator bool() const { return file != nullptr; }
+
+	/// @return Records read into out, less than n only at the end
+	size_t read(TraceRecord *out, size_t n);
+	/// @brief Continue reading from the n-th record
+	/// @return false if there is no such record
+	bool seek(std::uint64_t n);
+
+private:
+	std::FILE *file = nullptr;
+};
+
+#endif // END trace.hxx
@@ -0,0 +1,189 @@
+// Execution trace tools, for traces recorded with c8run --trace.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "trace.hxx"
+
+using std::clog;
+using std::string;
+using std::string_view;
+using std::uint64_t;
+using std::vector;
+
+/// Records read at a time
+constexpr size_t READ_RECORDS = 1 << 16;
+
+static void print_usage(const char *name)
+{
+	clog << "Usage: " << name << " dump [options] <trace>\n"
+		 << "  Print the records of a trace as text, a line for each:\n"
+		 << "  step, address, opcode, instruction and the state it left\n"
+		 << "Options:\n"
+		 << "  -s <step>   First step to print (default: 0)\n"
+		 << "  -n <steps>  Steps to print (default: all)\n"
+		 << "\n"
+		 << "Usage: " << name << " diff [options] <trace> <trace>\n"
+		 << "  Find the first step where two traces differ, exits with 0 if\n"
+		 << "  they are the same, 1 if they differ and 2 on errors\n"
+		 << "Options:\n"
+		 << "  -C <steps>  Steps of context to print around it (default: 5)\n";
+}
+
+static int dump(const char *path, uint64_t first, uint64_t count)
+{
+	TraceReader reader(path);
+	if (!reader)
+		return 2;
+
+	if (!reader.seek(first))
+		return 0; // Nothing from there on
+
+	vector<TraceRecord> records(READ_RECORDS);
+	uint64_t step = first;
+	auto end = count > UINT64_MAX - first ? UINT64_MAX : first + count;
+	while (step < end) {
+		auto n = reader.read(records.data(), records.size());
+		if (n == 0)
+			break;
+		for (size_t i = 0; i < n && step < end; ++i, ++step)
+			std::printf(
+				"%10llu  %s\n", (unsigned long long)step,
+				format_record(records[i]).c_str()
+			);
+	}
+	return 0;
+}
+
+/// @brief Names of the fields in which the records differ
+static string differing_fields(const TraceRecord &a, const TraceRecord &b)
+{
+	string ret;
+	auto add = [&ret](bool differs, const char *name) {
+		if (!differs)
+			return;
+		if (!ret.empty())
+			ret += ", ";
+		ret += name;
+	};
+	add(a.pc != b.pc, "PC");
+	add(a.opcode != b.opcode, "opcode");
+	add(a.index != b.index, "I");
+	add(a.reg != b.reg || a.value != b.value, "Vx");
+	add(a.vf != b.vf, "VF");
+	add(a.key != b.key, "key");
+	return ret;
+}
+
+/// @brief Print the steps around the mismatch from both traces
+static void print_context(
+	const char *path_a, const char *path_b, uint64_t mismatch, uint64_t context
+)
+{
+	auto first = mismatch > context ? mismatch - context : 0;
+	auto cnt = mismatch - first + 1 + context;
+	for (auto path : {path_a, path_b}) {
+		std::printf("\n%s:\n", path);
+		TraceReader reader(path);
+		vector<TraceRecord> records(cnt);
+		if (!reader || !reader.seek(first))
+			continue;
+		auto n = reader.read(records.data(), cnt);
+		for (size_t i = 0; i < n; ++i)
+			std::printf(
+				"%c %10llu  %s\n", first + i == mismatch ? '>' : ' ',
+				(unsigned long long)(first + i), format_record(records[i]).c_str()
+			);
+	}
+}
+
+static int diff(const char *path_a, const char *path_b, uint64_t context)
+{
+	TraceReader a(path_a);
+	TraceReader b(path_b);
+	if (!a || !b)
+		return 2;
+
+	// Blocks are compared whole, records only in a block which differs
+	vector<TraceRecord> block_a(READ_RECORDS);
+	vector<TraceRecord> block_b(READ_RECORDS);
+	uint64_t step = 0;
+	while (true) {
+		auto n_a = a.read(block_a.data(), block_a.size());
+		auto n_b = b.read(block_b.data(), block_b.size());
+		auto n = std::min(n_a, n_b);
+		if (std::memcmp(block_a.data(), block_b.data(), n * sizeof(TraceRecord))
+			!= 0) {
+			size_t i = 0;
+			while (std::memcmp(&block_a[i], &block_b[i], sizeof(TraceRecord)) == 0)
+				i++;
+			std::printf(
+				"Traces differ at step %llu in: %s\n",
+				(unsigned long long)(step + i),
+				differing_fields(block_a[i], block_b[i]).c_str()
+			);
+			print_context(path_a, path_b, step + i, context);
+			return 1;
+		}
+		step += n;
+
+		if (n_a != n_b) {
+			std::printf(
+				"Traces are the same for %llu steps, then %s ends\n",
+				(unsigned long long)step, n_a < n_b ? path_a : path_b
+			);
+			print_context(path_a, path_b, step, context);
+			return 1;
+		}
+		if (n == 0)
+			break;
+	}
+
+	std::printf("Traces are the same, %llu steps\n", (unsigned long long)step);
+	return 0;
+}
+
+int main(int argc, char const **argv)
+{
+	auto name = argc > 0 ? argv[0] : "c8trace";
+	string_view command = argc > 1 ? argv[1] : "";
+	if (command != "dump" && command != "diff") {
+		print_usage(name);
+		return 2;
+	}
+
+	uint64_t first = 0;
+	uint64_t count = UINT64_MAX;
+	uint64_t context = 5;
+	vector<const char *> paths;
+	for (int i = 2; i < argc; ++i) {
+		string_view arg = argv[i];
+		if (command == "dump" && arg == "-s" && i + 1 < argc) {
+			first = std::strtoull(argv[++i], nullptr, 10);
+		} else if (command == "dump" && arg == "-n" && i + 1 < argc) {
+			count = std::strtoull(argv[++i], nullptr, 10);
+		} else if (command == "diff" && arg == "-C" && i + 1 < argc) {
+			context = std::strtoull(argv[++i], nullptr, 10);
+		} else if (!arg.empty() && arg[0] != '-') {
+			paths.push_back(argv[i]);
+		} else {
+			print_usage(name);
+			return 2;
+		}
+	}
+	if (paths.size() != (command == "dump" ? 1 : 2)) {
+		print_usage(name);
+		return 2;
+	}
+
+	if (command == "dump")
+		return dump(paths[0], first, count);
+	return diff(paths[0], paths[1], context);
+}
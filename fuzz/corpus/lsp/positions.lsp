@@ -0,0 +1,21 @@
+Content-Length: 58
+
+{"jsonrpc":"2.0","id":1,"method":"initialize","params":{}}Content-Length: 52
+
+{"jsonrpc":"2.0","method":"initialized","params":{}}Content-Length: 165
+
+{"jsonrpc":"2.0","method":"textDocument/didOpen","params":{"textDocument":{"uri":"file:///fuzz.asm","languageId":"chip8","version":1,"text":"start:\n\tjp start\n"}}}Content-Length: 145
+
+{"jsonrpc":"2.0","id":2,"method":"textDocument/hover","params":{"textDocument":{"uri":"file:///fuzz.asm"},"position":{"line":-1,"character":-5}}}Content-Length: 155
+
+{"jsonrpc":"2.0","id":3,"method":"textDocument/definition","params":{"textDocument":{"uri":"file:///fuzz.asm"},"position":{"line":1e+300,"character":2.5}}}Content-Length: 158
+
+{"jsonrpc":"2.0","id":4,"method":"textDocument/completion","params":{"textDocument":{"uri":"file:///fuzz.asm"},"position":{"line":-1e+300,"character":1e+19}}}Content-Length: 233
+
+{"jsonrpc":"2.0","method":"textDocument/didChange","params":{"textDocument":{"uri":"file:///fuzz.asm","version":2},"contentChanges":[{"range":{"start":{"line":-3,"character":1e+300},"end":{"line":1e+19,"character":-1}},"text":"x"}]}}Content-Length: 143
+
+{"jsonrpc":"2.0","id":5,"method":"textDocument/hover","params":{"textDocument":{"uri":"file:///fuzz.asm"},"position":{"line":0,"character":0}}}Content-Length: 59
+
+{"jsonrpc":"2.0","id":99,"method":"shutdown","params":null}Content-Length: 47
+
+{"jsonrpc":"2.0","method":"exit","params":null}
\ No newline at end of file
@@ -0,0 +1,21 @@
+Content-Length: 58
+
+{"jsonrpc":"2.0","id":1,"method":"initialize","params":{}}Content-Length: 52
+
+{"jsonrpc":"2.0","method":"initialized","params":{}}Content-Length: 816
+
+{"jsonrpc":"2.0","method":"textDocument/didOpen","params":{"textDocument":{"uri":"file:///fuzz.asm","languageId":"chip8","version":1,"text":"define W v2\ndefine A v3\ndefine S v4\ndefine D v5\ndefine KEY vC\ndefine BEEP_TIME vD\ndefine XPOS v0\ndefine YPOS v1\ndefine LIM vA\ndefine ONE vB\n\n\tld I, ball ; Load sprite\n\tld ONE, 1\n\tld XPOS, 0\n\tld YPOS, 0\n\tld W, 0x5 ; W\n\tld A, 0x7 ; A\n\tld S, 0x8 ; S\n\tld D, 0x9 ; D\n\tld BEEP_TIME, 4\nloop:\n\tld KEY, K\n\tld ST, BEEP_TIME\n\t; Move X\n\tsknp A\n\tsub XPOS, ONE\n\tsknp D\n\tadd XPOS, ONE\n\t; Move Y\n\tsknp S\n\tadd YPOS, ONE ; Y is inverted\n\tsknp W\n\tsub YPOS, ONE\n\t; Constrain\n\tld LIM, 63\n\tand XPOS, LIM\n\tld LIM, 31\n\tand YPOS, LIM\n\t; Clear & Draw\n\tcls\n\tdrw XPOS, YPOS, 2\n\tjp loop\n\n\nball:\ndb 0b11000000\ndb 0b11000000\n"}}}Content-Length: 143
+
+{"jsonrpc":"2.0","id":2,"method":"textDocument/hover","params":{"textDocument":{"uri":"file:///fuzz.asm"},"position":{"line":3,"character":2}}}Content-Length: 148
+
+{"jsonrpc":"2.0","id":3,"method":"textDocument/definition","params":{"textDocument":{"uri":"file:///fuzz.asm"},"position":{"line":5,"character":6}}}Content-Length: 239
+
+{"jsonrpc":"2.0","method":"textDocument/didChange","params":{"textDocument":{"uri":"file:///fuzz.asm","version":2},"contentChanges":[{"range":{"start":{"line":2,"character":0},"end":{"line":2,"character":0}},"text":"\tld v3, 1\nnew:\n"}]}}Content-Length: 148
+
+{"jsonrpc":"2.0","id":4,"method":"textDocument/completion","params":{"textDocument":{"uri":"file:///fuzz.asm"},"position":{"line":3,"character":2}}}Content-Length: 143
+
+{"jsonrpc":"2.0","id":5,"method":"textDocument/hover","params":{"textDocument":{"uri":"file:///fuzz.asm"},"position":{"line":2,"character":2}}}Content-Length: 59
+
+{"jsonrpc":"2.0","id":99,"method":"shutdown","params":null}Content-Length: 47
+
+{"jsonrpc":"2.0","method":"exit","params":null}
\ No newline at end of file
@@ -0,0 +1,25 @@
+	ld v0, 0 ; Position
+	ld v1, 0
+	ld v2, 1 ; Direction
+	ld v3, 1
+	ld I, ball
+loop:
+	drw v0, v1, 4
+	drw v0, v1, 4
+	add v0, v2
+	add v1, v3
+	se v0, 60
+	jp left
+	ld v2, 255
+left:
+	sne v0, 0
+	ld v2, 1
+	se v1, 28
+	jp top
+	ld v3, 255
+top:
+	sne v1, 0
+	ld v3, 1
+	jp loop
+ball:
+	db 0x60, 0xF0, 0xF0, 0x60
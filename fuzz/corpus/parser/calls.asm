@@ -0,0 +1,20 @@
+loop:
+	call first
+	call second
+	jp loop
+first:
+	add v0, 1
+	call common
+	ret
+second:
+	rnd v1, 0xFF
+	call common
+	ret
+common:
+	ld I, buffer
+	ld [I], v3
+	ld v3, [I]
+	xor v2, v1
+	ret
+buffer:
+	db 0, 0, 0, 0
@@ -0,0 +1,20 @@
+	ld v5, 0
+loop:
+	add v5, 1
+	ld I, digits
+	ld B, v5
+	ld v2, [I]
+	cls
+	ld v3, 0
+	ld v4, 0
+	ld F, v0
+	drw v3, v4, 5
+	add v3, 5
+	ld F, v1
+	drw v3, v4, 5
+	add v3, 5
+	ld F, v2
+	drw v3, v4, 5
+	jp loop
+digits:
+	db 0, 0, 0
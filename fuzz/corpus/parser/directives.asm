@@ -0,0 +1,34 @@
+; Every directive but include and incbin, and expressions
+define SPEED 3
+define TOP (SPEED * 2 + 1) % 16
+
+	macro SETXY rx, ry, x, y
+	ld rx, x
+	ld ry, y
+	endm
+
+start:
+	SETXY v0, v1, 10, TOP
+	ld I, sprite
+	drw v0, v1, 4
+	ld vA, K
+	sknp vA
+	add v0, SPEED
+	shl v2
+	shr v3
+	subn v4, v5
+	ld v6, DT
+	ld ST, v6
+	ld B, v0
+	ld [I], v3
+	ld v3, [I]
+	jp v0, table
+	call done
+	jp start
+done:
+	ret
+table:
+	dw start, done, 0x1234 >> 4
+sprite:
+	db 0b11110000, 0x90, 0x90 | 0x60, -1 & 0xF0
+	fill 4, 0xAA
@@ -0,0 +1,23 @@
+; Includes the library of the fuzz target, expands its macros and copies
+; its data
+include "lib.inc"
+
+	macro TWICE r
+	CLEAR r
+	add r, LIB_SIZE
+	add r, LIB_SIZE
+	endm
+
+	macro DRAW x, y, sprite
+	ld I, sprite
+	drw x, y, LIB_SIZE
+	endm
+
+start:
+	TWICE v0
+	TWICE v1
+	DRAW v0, v1, lib_sprite
+	DRAW v1, v0, data
+	jp start
+data:
+	incbin "data.bin"
@@ -0,0 +1,9 @@
+	ld v0, 5
+	ld v1, 5
+
+loop:
+	ld v4, K
+	ld F, v4
+	cls
+	drw v0, v1, 5
+	jp loop
@@ -0,0 +1,7 @@
+; Expressions nested within and past the limit of the parser
+	ld v0, ((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((1))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+	ld v1, -~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~-~5
+	db hi(lo(-(~(2 * (3 + 4)) << 1)))
+	ld v2, -(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~-(~1))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+	ld v3, ((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((1))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+	dw +-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~+-~7
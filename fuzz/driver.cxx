@@ -0,0 +1,194 @@
+// Runs a fuzz target without libFuzzer, for compilers which do not have it.
+// Replays the inputs given, files or directories of them, then with -runs=N
+// runs N inputs made by mutating them at random. It is not coverage guided,
+// but finds what the sanitizers catch on inputs near the seed corpus. The
+// input being run when the target crashes, or runs longer than -timeout=N
+// seconds, is written to crash-input.
+
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unistd.h>
+#if __has_include(<sanitizer/common_interface_defs.h>)
+#include <sanitizer/common_interface_defs.h>
+#define C8_HAS_SANITIZER_API
+#endif
+
+namespace fs = std::filesystem;
+using std::clog;
+using std::size_t;
+using std::string_view;
+using std::uint64_t;
+using std::uint8_t;
+using std::vector;
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+// Input being run, written out if it crashes
+static const vector<uint8_t> *current = nullptr;
+
+static void save_current()
+{
+	if (!current)
+		return;
+	if (auto file = std::fopen("crash-input", "wb")) {
+		std::fwrite(current->data(), 1, current->size(), file);
+		std::fclose(file);
+		std::fprintf(stderr, "Input written to crash-input\n");
+	}
+	current = nullptr;
+}
+
+static void on_signal(int sig)
+{
+	save_current();
+	std::signal(sig, SIG_DFL);
+	std::raise(sig);
+}
+
+static void on_timeout(int)
+{
+	std::fprintf(stderr, "Input timed out\n");
+	save_current();
+	std::_Exit(1);
+}
+
+// Seconds an input may run for, 0 for no limit
+static unsigned timeout = 10;
+
+static void run(const vector<uint8_t> &input)
+{
+	current = &input;
+	alarm(timeout);
+	LLVMFuzzerTestOneInput(input.data(), input.size());
+	alarm(0);
+	current = nullptr;
+}
+
+static bool read_input(const fs::path &path, vector<vector<uint8_t>> &inputs)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		clog << "Cannot open file '" << path.string() << "'\n";
+		return false;
+	}
+	inputs.emplace_back(
+		std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()
+	);
+	return true;
+}
+
+/// @brief Change an input by 1 to 4 random edits of its bytes
+static void mutate(vector<uint8_t> &input, size_t max_len, std::mt19937_64 &rng)
+{
+	auto edits = 1 + rng() % 4;
+	for (unsigned i = 0; i < edits; ++i) {
+		auto at = input.empty() ? 0 : rng() % input.size();
+		switch (rng() % 5) {
+		case 0:
+			if (!input.empty())
+				input[at] ^= 1 << rng() % 8;
+			break;
+		case 1:
+			if (!input.empty())
+				input[at] = rng();
+			break;
+		case 2:
+			if (input.size() < max_len)
+				input.insert(input.begin() + at, uint8_t(rng()));
+			break;
+		case 3:
+			if (!input.empty())
+				input.erase(input.begin() + at);
+			break;
+		default: {
+			// Copy a run of bytes over another place
+			if (input.empty())
+				break;
+			auto from = rng() % input.size();
+			auto len = rng() % (input.size() - std::max(at, from)) + 1;
+			std::copy_n(input.begin() + from, len, input.begin() + at);
+			break;
+		}
+		}
+	}
+}
+
+int main(int argc, char const **argv)
+{
+	uint64_t runs = 0;
+	uint64_t seed = 1;
+	size_t max_len = 4096;
+	vector<vector<uint8_t>> inputs;
+	for (int i = 1; i < argc; ++i) {
+		string_view arg = argv[i];
+		if (arg.rfind("-runs=", 0) == 0) {
+			runs = std::strtoull(argv[i] + 6, nullptr, 10);
+		} else if (arg.rfind("-seed=", 0) == 0) {
+			seed = std::strtoull(argv[i] + 6, nullptr, 10);
+		} else if (arg.rfind("-max_len=", 0) == 0) {
+			max_len = std::strtoull(argv[i] + 9, nullptr, 10);
+		} else if (arg.rfind("-timeout=", 0) == 0) {
+			timeout = std::strtoul(argv[i] + 9, nullptr, 10);
+		} else if (!arg.empty() && arg[0] == '-') {
+			clog << "Usage: " << argv[0]
+				 << " [-runs=N] [-seed=N] [-max_len=N] [-timeout=N]\n"
+				 << "  <file|dir>...\n";
+			return 1;
+		} else if (fs::is_directory(argv[i])) {
+			vector<fs::path> paths;
+			for (auto &entry : fs::directory_iterator(argv[i]))
+				paths.push_back(entry.path());
+			std::sort(paths.begin(), paths.end());
+			for (auto &path : paths) {
+				if (!read_input(path, inputs))
+					return 1;
+			}
+		} else if (!read_input(argv[i], inputs)) {
+			return 1;
+		}
+	}
+
+#ifdef C8_HAS_SANITIZER_API
+	__sanitizer_set_death_callback(save_current);
+#endif
+	std::signal(SIGABRT, on_signal);
+	std::signal(SIGSEGV, on_signal);
+	std::signal(SIGALRM, on_timeout);
+
+	for (auto &input : inputs)
+		run(input);
+	std::printf("Replayed %zu inputs\n", inputs.size());
+	if (runs == 0)
+		return 0;
+
+	if (inputs.empty())
+		inputs.emplace_back();
+	std::mt19937_64 rng(seed);
+	vector<uint8_t> input;
+	auto start = std::chrono::steady_clock::now();
+	for (uint64_t i = 0; i < runs; ++i) {
+		input = inputs[rng() % inputs.size()];
+		mutate(input, max_len, rng);
+		run(input);
+	}
+	std::chrono::duration<double> took = std::chrono::steady_clock::now() - start;
+	std::printf(
+		"Ran %llu mutated inputs in %.3f s (%.0f execs/s)\n",
+		(unsigned long long)runs, took.count(),
+		took.count() > 0 ? runs / took.count() : 0.0
+	);
+	return 0;
+}
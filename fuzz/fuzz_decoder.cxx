@@ -0,0 +1,105 @@
+// Fuzz target of the decoder: decodes every word of the input and checks
+// the fields and to_string() of each against the word.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "chip8.hxx"
+#include "decoder.hxx"
+
+using std::string_view;
+using std::uint16_t;
+using std::uint8_t;
+
+/// @brief Bits of the operands in the format of an instruction, operands
+/// are the lowercase letters of the format
+static uint16_t operand_mask(string_view format)
+{
+	uint16_t ret = 0;
+	for (auto c : format) {
+		switch (c) {
+		case 'a':
+			ret |= 0x0FFF;
+			break;
+		case 'x':
+			ret |= 0x0F00;
+			break;
+		case 'y':
+			ret |= 0x00F0;
+			break;
+		case 'b':
+			ret |= 0x00FF;
+			break;
+		case 'n':
+			ret |= 0x000F;
+			break;
+		}
+	}
+	return ret;
+}
+
+/// @brief If the word is an encoding of the instruction
+static bool encodes(uint16_t word, Instruction type)
+{
+	auto mask = operand_mask(ins_format(type));
+	// The decoder does not check the low nibble of 5xy0 and 9xy0, and SHR
+	// and SHL are 8xy6 and 8xyE with Vy unused
+	if (type == Instruction::SE_v_v || type == Instruction::SNE_v_v)
+		mask |= 0x000F;
+	if (type == Instruction::SHR_v || type == Instruction::SHL_v)
+		mask |= 0x00F0;
+	return (word & ~mask) == OPCODES[static_cast<int>(type)];
+}
+
+static void fail(uint16_t word, const char *what)
+{
+	std::clog << "Word 0x" << std::hex << word << ": " << what << '\n';
+	std::abort();
+}
+
+static void check(uint16_t word)
+{
+	DecodedIns ins(word);
+	if (ins.bincode != word || ins.vx != (word >> 8 & 0xF)
+		|| ins.vy != (word >> 4 & 0xF) || ins.addr != (word & 0xFFF)
+		|| ins.byte != (word & 0xFF) || ins.nibble != (word & 0xF))
+		fail(word, "fields differ from the word");
+
+	auto text = ins.to_string();
+	if (ins.type == Instruction::ILLEGAL) {
+		if (text != "<! DECODING ERROR !>")
+			fail(word, "illegal word is not shown as an error");
+		for (int i = 0; i < INSTRUCTION_CNT - 1; ++i) {
+			if (encodes(word, Instruction(i)))
+				fail(word, "instruction is decoded as illegal");
+		}
+		return;
+	}
+
+	if (!encodes(word, ins.type))
+		fail(word, "decoded as an instruction of another encoding");
+	// Mnemonic first, then the operands
+	auto format = ins_format(ins.type);
+	auto mnemonic = format.substr(0, format.find(' '));
+	if (text.compare(0, mnemonic.size(), mnemonic) != 0
+		|| (text.size() > mnemonic.size() && text[mnemonic.size()] != ' '))
+		fail(word, "text does not start with the mnemonic");
+	// Registers are shown by name
+	if (format.find('x') != string_view::npos
+		&& text.find(REGISTERS[ins.vx]) == std::string::npos)
+		fail(word, "text does not have Vx");
+	if (format.find('y') != string_view::npos
+		&& text.find(REGISTERS[ins.vy]) == std::string::npos)
+		fail(word, "text does not have Vy");
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, std::size_t size)
+{
+	for (std::size_t i = 0; i + 1 < size; i += C8_INS_LEN)
+		check(data[i] << 8 | data[i + 1]);
+	return 0;
+}
@@ -0,0 +1,56 @@
+// Fuzz target of the emulator: runs the input as a ROM for a bounded number
+// of steps with keys pressed along the way, then checks its state against
+// the reference model run alike. The emulator is reset for each input, not
+// constructed again.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "chip8.hxx"
+#include "emulator.hxx"
+#include "reference.hxx"
+
+using std::uint8_t;
+
+/// Steps to run each input for
+constexpr unsigned MAX_STEPS = 4096;
+/// Steps each key is held for, the keys and no key take turns
+constexpr unsigned KEY_STEPS = 64;
+
+static Emulator emu(nullptr, nullptr);
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, std::size_t size)
+{
+	if (size > C8_RAM_SIZE - C8_PROG_START)
+		return 0;
+
+	emu.reset(data, data + size);
+	emu.seed(1);
+	emu.set_step_time(1.0 / 300);
+	Reference ref(data, data + size);
+	ref.seed(1);
+	ref.set_step_time(1.0 / 300);
+
+	unsigned step = 0;
+	for (; step < MAX_STEPS; ++step) {
+		emu.key = ref.key = step / KEY_STEPS % (C8_KEY_CNT + 1);
+		bool is_legal = emu.step();
+		if (is_legal != ref.step()) {
+			std::clog << "Step " << step << ": only one found it illegal\n";
+			std::abort();
+		}
+		if (!is_legal)
+			break;
+	}
+
+	auto fields = differing_state(emu, ref);
+	if (!fields.empty()) {
+		std::clog << "State differs from the reference after " << step
+				  << " steps in: " << fields << '\n';
+		std::abort();
+	}
+	return 0;
+}
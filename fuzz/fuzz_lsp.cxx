@@ -0,0 +1,55 @@
+// Fuzz target of the language server: serves the input as the messages a
+// client sends, the replies are thrown away.
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <unistd.h>
+
+#include "lsp.hxx"
+
+using std::string;
+using std::string_view;
+
+/// @brief If the text has the word in any case
+static bool has_word(string text, string_view word)
+{
+	std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) {
+		return std::tolower(c);
+	});
+	return text.find(word) != string::npos;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size)
+{
+	// Messages are read from a file, a pipe would block on large inputs.
+	// Reading a file never waits, so documents are only assembled by the
+	// requests which need them.
+	static auto in = std::tmpfile();
+	static auto out = std::fopen("/dev/null", "w");
+	if (!in || !out) {
+		std::clog << "Cannot open the files of the language server\n";
+		std::abort();
+	}
+
+	string text(reinterpret_cast<const char *>(data), size);
+	// The paths of documents are real, an input could read any file
+	if (has_word(text, "include") || has_word(text, "incbin"))
+		return 0;
+
+	auto fd = fileno(in);
+	if (ftruncate(fd, 0) != 0 || pwrite(fd, data, size, 0) != ssize_t(size)
+		|| lseek(fd, 0, SEEK_SET) != 0) {
+		std::clog << "Cannot write the input\n";
+		std::abort();
+	}
+	LanguageServer(fd, out).run();
+	return 0;
+}
@@ -0,0 +1,113 @@
+// Fuzz target of the assembler: preprocesses and assembles the input as
+// source text, without and with the optimizer. The input can include the
+// files of a directory made for it.
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <unistd.h>
+
+#include "parser.hxx"
+#include "preprocessor.hxx"
+
+namespace fs = std::filesystem;
+using std::string;
+using std::string_view;
+
+/// Files which inputs can include or incbin, by name
+static const std::pair<const char *, string_view> INCLUDED_FILES[] = {
+	{"lib.inc", "define LIB_SIZE 4\n"
+				"\tmacro CLEAR r\n"
+				"\tld r, 0\n"
+				"\tendm\n"
+				"lib_sprite:\n"
+				"\tdb 0xF0, 0x90, 0x90, 0xF0\n"},
+	{"data.bin", string_view("\x12\x00\xA2\x08\xD0\x15\x00\xEE", 8)},
+};
+
+/// @brief If the text has the word in any case
+static bool has_word(string text, string_view word)
+{
+	std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) {
+		return std::tolower(c);
+	});
+	return text.find(word) != string::npos;
+}
+
+// Directory which has only the files inputs can include, removed at exit
+static char include_dir[] = "/tmp/c8fuzz_parser.XXXXXX";
+
+/// @brief Path of the main file, in the directory of the included files
+static const string &main_path()
+{
+	static const string path = [] {
+		if (!mkdtemp(include_dir)) {
+			std::clog << "Cannot make the directory of included files\n";
+			std::abort();
+		}
+		for (auto [name, text] : INCLUDED_FILES)
+			std::ofstream(fs::path(include_dir) / name, std::ios::binary) << text;
+		std::atexit([] {
+			std::error_code ec;
+			fs::remove_all(include_dir, ec);
+		});
+		return string(include_dir) + "/fuzz.asm";
+	}();
+	return path;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size)
+{
+	auto text = std::make_shared<const string>(
+		reinterpret_cast<const char *>(data), size
+	);
+	// Paths of include and incbin are relative to the main file, unless they
+	// have a slash. Defines and macros could make a path from any part of
+	// the input, so an input reading files must have no slash at all. Else
+	// it could read any file, /dev/zero never ends.
+	if ((has_word(*text, "include") || has_word(*text, "incbin"))
+		&& text->find('/') != string::npos)
+		return 0;
+
+	// The scanned lines keep the text alive, like an unsaved file's do
+	struct Snapshot {
+		std::shared_ptr<const string> text;
+		ScannedFile file;
+	};
+	auto snapshot = std::make_shared<Snapshot>();
+	snapshot->text = text;
+	string_view rest = *text;
+	while (!rest.empty()) {
+		auto nl = rest.find('\n');
+		auto line = rest.substr(0, nl);
+		snapshot->file.text.push_back(line);
+		snapshot->file.lines.push_back(scan_line(line));
+		rest.remove_prefix(nl == string_view::npos ? rest.size() : nl + 1);
+	}
+	std::shared_ptr<const ScannedFile> main(snapshot, &snapshot->file);
+
+	Preprocessor preprocessor(false);
+	auto source = preprocessor.run(main_path(), std::move(main));
+	// Lines lost on the way would leave nothing to fuzz the parser with
+	if (!text->empty() && source->lines.empty()) {
+		std::clog << "Preprocessing lost all the lines\n";
+		std::abort();
+	}
+	for (bool is_optimizing : {false, true}) {
+		Parser parser(source);
+		parser.set_reporting(false);
+		parser.set_optimize(is_optimizing);
+		parser.parse_and_assemble();
+	}
+	return 0;
+}
@@ -25,6 +25,7 @@ enum Chip8Info {
 	C8_RAM_SIZE = 4096,
 	C8_ADDR_MAX = C8_RAM_SIZE - 1,
 	C8_BYTE_MAX = 255,
+	C8_WORD_MAX = 65535,
 	C8_NIBBLE_MAX = 15,
 
 	C8_FONT_HEIGHT = 5,
@@ -96,10 +97,20 @@ enum class Instruction {
 	ILLEGAL,
 };
 
+/// @brief Number of instruction types, ILLEGAL included
+constexpr int INSTRUCTION_CNT = static_cast<int>(Instruction::ILLEGAL) + 1;
+
 /// @brief Convenience directives for assembly
 enum class Directive {
 	DB,
+	DW,
+	FILL,
+	ALIGN,
+	INCBIN,
 	DEFINE,
+	INCLUDE,
+	MACRO,
+	ENDM,
 };
 
 /// @brief Register Mnemonics
@@ -130,7 +141,14 @@ constexpr std::uint16_t OPCODES[] = {
 /// @brief Directive mnemonics, ordered according to Directive enum
 constexpr std::string_view DIRECTIVES[] = {
 	"DB",
+	"DW",
+	"FILL",
+	"ALIGN",
+	"INCBIN",
 	"DEFINE",
+	"INCLUDE",
+	"MACRO",
+	"ENDM",
 };
 
 #endif